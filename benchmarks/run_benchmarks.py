@@ -0,0 +1,257 @@
+"""
+═══════════════════════════════════════════════════════════════
+TINYTALK BENCHMARK SUITE
+Continuous performance harness for both interpreters
+═══════════════════════════════════════════════════════════════
+
+Covers Lexer.tokenize, Parser.parse, and Runtime.execute hot patterns
+(loops, recursion, step chains, string building) for realTinyTalk and
+newTinyTalk. Results compare against benchmarks/baseline.json; a benchmark
+slower than baseline * threshold fails the run, so perf claims in this
+tree stay verifiable in CI.
+
+Usage:
+    python3 benchmarks/run_benchmarks.py              # run + gate
+    python3 benchmarks/run_benchmarks.py --update     # rewrite baseline
+    python3 benchmarks/run_benchmarks.py --filter lexer
+    python3 benchmarks/run_benchmarks.py --threshold 2.0
+"""
+
+import argparse
+import json
+import sys
+import time
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent.parent))
+
+BASELINE_PATH = Path(__file__).parent / "baseline.json"
+
+# ═══════════════════════════════════════════════════════════════
+# Workloads
+# ═══════════════════════════════════════════════════════════════
+
+GENERATED_SCRIPT = "\n".join(
+    f'let value_{i} = {i} * 3 + 1  // generated line\n'
+    f'show("row " + value_{i}.str)'
+    for i in range(500)
+)
+
+LOOP_SCRIPT = """
+let total = 0
+for i in 0..20000 {
+    total = total + i * 2
+}
+show(total)
+"""
+
+RECURSION_SCRIPT = """
+fn fib(n) {
+    if n < 2 { return n }
+    return fib(n - 1) + fib(n - 2)
+}
+show(fib(16))
+"""
+
+STEP_CHAIN_SCRIPT = """
+let xs = range(5000)
+let out = xs _filter((x) => x % 3 == 0) _map((x) => x * 2) _take(100) _sum
+show(out)
+"""
+
+STRING_SCRIPT = """
+let s = ""
+for i in 0..2000 {
+    s = s + "x"
+}
+show(len(s))
+"""
+
+
+def _real_bounds():
+    from realTinyTalk.kernel import ExecutionBounds
+    return ExecutionBounds(max_ops=100_000_000, max_iterations=10_000_000)
+
+
+def _new_bounds():
+    from newTinyTalk.kernel import ExecutionBounds
+    return ExecutionBounds(max_ops=100_000_000, max_iterations=10_000_000,
+                           max_recursion=5000)
+
+
+def _silent_real(source, engine='ast'):
+    import io
+    from contextlib import redirect_stdout
+    from realTinyTalk import run
+    buf = io.StringIO()
+    with redirect_stdout(buf):
+        run(source, bounds=_real_bounds(), engine=engine)
+
+
+def _silent_new(source, **kernel_kwargs):
+    from newTinyTalk import TinyTalkKernel
+    result = TinyTalkKernel(bounds=_new_bounds(), **kernel_kwargs).run(source)
+    assert result.success, result.error
+
+
+def bench_real_lexer():
+    from realTinyTalk.lexer import Lexer
+    Lexer(GENERATED_SCRIPT).tokenize()
+
+
+def bench_real_parser():
+    from realTinyTalk.lexer import Lexer
+    from realTinyTalk.parser import Parser
+    tokens = Lexer(GENERATED_SCRIPT).tokenize()
+    Parser(tokens).parse()
+
+
+def bench_real_loop():
+    _silent_real(LOOP_SCRIPT)
+
+
+def bench_real_loop_vm():
+    _silent_real(LOOP_SCRIPT, engine='vm')
+
+
+def bench_real_recursion():
+    _silent_real(RECURSION_SCRIPT)
+
+
+def bench_real_step_chain():
+    _silent_real(STEP_CHAIN_SCRIPT)
+
+
+def bench_real_strings():
+    _silent_real(STRING_SCRIPT)
+
+
+def bench_new_lexer():
+    from newTinyTalk.lexer import Lexer
+    Lexer(GENERATED_SCRIPT).tokenize()
+
+
+def bench_new_parser():
+    from newTinyTalk.lexer import Lexer
+    from newTinyTalk.parser import Parser
+    tokens = Lexer(LOOP_SCRIPT * 50).tokenize()
+    Parser(tokens).parse()
+
+
+NEW_LOOP_SCRIPT = """
+let total = 0
+for i in range(20000) {
+    total = total + i * 2
+}
+show(total)
+"""
+
+
+def bench_new_loop():
+    _silent_new(NEW_LOOP_SCRIPT)
+
+
+def bench_new_recursion():
+    # Measures the opt-in JIT tier on a hot recursive function
+    _silent_new(RECURSION_SCRIPT, jit=True)
+
+
+def bench_new_step_chain():
+    _silent_new(STEP_CHAIN_SCRIPT)
+
+
+BENCHMARKS = [
+    ("real_lexer_tokenize", bench_real_lexer),
+    ("real_parser_parse", bench_real_parser),
+    ("real_execute_loop", bench_real_loop),
+    ("real_execute_loop_vm", bench_real_loop_vm),
+    ("real_execute_recursion", bench_real_recursion),
+    ("real_step_chain", bench_real_step_chain),
+    ("real_string_build", bench_real_strings),
+    ("new_lexer_tokenize", bench_new_lexer),
+    ("new_parser_parse", bench_new_parser),
+    ("new_execute_loop", bench_new_loop),
+    ("new_execute_recursion", bench_new_recursion),
+    ("new_step_chain", bench_new_step_chain),
+]
+
+
+# ═══════════════════════════════════════════════════════════════
+# Harness
+# ═══════════════════════════════════════════════════════════════
+
+def measure(fn, warmup: int = 1, repeat: int = 5) -> float:
+    """Best-of-N wall time in seconds (best-of filters scheduler noise)."""
+    for _ in range(warmup):
+        fn()
+    best = float('inf')
+    for _ in range(repeat):
+        start = time.perf_counter()
+        fn()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description='TinyTalk benchmark suite')
+    parser.add_argument('--update', action='store_true',
+                        help='rewrite baseline.json with current numbers')
+    parser.add_argument('--filter', type=str, default=None,
+                        help='run only benchmarks whose name contains this')
+    parser.add_argument('--threshold', type=float, default=1.5,
+                        help='fail when slower than baseline * threshold')
+    parser.add_argument('--repeat', type=int, default=5)
+    args = parser.parse_args()
+
+    baseline = {}
+    if BASELINE_PATH.exists():
+        baseline = json.loads(BASELINE_PATH.read_text())
+
+    selected = [(n, f) for n, f in BENCHMARKS
+                if not args.filter or args.filter in n]
+    if not selected:
+        print("No benchmarks matched filter")
+        return 1
+
+    print("=" * 68)
+    print("  TINYTALK BENCHMARKS")
+    print("=" * 68)
+
+    results = {}
+    regressions = []
+    for name, fn in selected:
+        elapsed = measure(fn, repeat=args.repeat)
+        results[name] = elapsed
+        base = baseline.get(name)
+        if base:
+            ratio = elapsed / base
+            status = "OK  " if ratio <= args.threshold else "SLOW"
+            if ratio > args.threshold:
+                regressions.append((name, ratio))
+            print(f"  [{status}] {name:28} {elapsed*1000:9.2f}ms "
+                  f"(baseline {base*1000:.2f}ms, {ratio:.2f}x)")
+        else:
+            print(f"  [NEW ] {name:28} {elapsed*1000:9.2f}ms")
+
+    print("-" * 68)
+
+    if args.update:
+        merged = dict(baseline)
+        merged.update(results)
+        BASELINE_PATH.write_text(json.dumps(merged, indent=2) + "\n")
+        print(f"Baseline updated: {BASELINE_PATH}")
+        return 0
+
+    if regressions:
+        print(f"REGRESSIONS ({len(regressions)}):")
+        for name, ratio in regressions:
+            print(f"  {name}: {ratio:.2f}x over baseline "
+                  f"(threshold {args.threshold}x)")
+        return 1
+
+    print(f"All {len(selected)} benchmarks within {args.threshold}x of baseline")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -99,9 +99,21 @@ class BinaryOp(ASTNode):
     left: ASTNode = None
     right: ASTNode = None
 
+    # Per-site inline cache: the runtime installs a type-specialized
+    # operator function here after observing operand types (see
+    # runtime._BINOP_SPECS); None means unspecialized
+    _spec = None
+
     def __post_init__(self):
         self.type = NodeType.BINARY_OP
 
+    def __getstate__(self):
+        # The installed specialization is a closure - drop it when the AST
+        # is pickled (parallel workers re-specialize from scratch)
+        state = self.__dict__.copy()
+        state.pop('_spec', None)
+        return state
+
 
 @dataclass
 class UnaryOp(ASTNode):
@@ -45,10 +45,16 @@ class TinyTalkKernel:
         bounds: Optional[ExecutionBounds] = None,
         capture_output: bool = True,
         source_dir: str = "",
+        sql_engine=None,
+        parallel_hof: bool = False,
+        jit: bool = False,
     ):
         self.bounds = bounds or ExecutionBounds()
         self.capture_output = capture_output
         self.source_dir = source_dir
+        self.sql_engine = sql_engine
+        self.parallel_hof = parallel_hof
+        self.jit = jit
 
     def run(self, source: str) -> RunResult:
         """Execute TinyTalk source code and return a RunResult."""
@@ -62,7 +68,10 @@ class TinyTalkKernel:
             ast = Parser(tokens).parse()
 
             # 3. Execute
-            runtime = Runtime(self.bounds, source_dir=self.source_dir)
+            runtime = Runtime(self.bounds, source_dir=self.source_dir,
+                              sql_engine=self.sql_engine,
+                              parallel_hof=self.parallel_hof,
+                              jit=self.jit)
 
             if self.capture_output:
                 buf: list = []
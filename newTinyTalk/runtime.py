@@ -104,6 +104,10 @@ class TinyFunction:
     closure: Scope
     is_native: bool = False
     native_fn: Optional[Callable] = None
+    # JIT tier state (see Runtime._jit_compile)
+    call_count: int = 0
+    jit_fn: Optional[Callable] = None
+    jit_state: str = "cold"  # cold | compiled | unsupported
 
 
 @dataclass
@@ -154,14 +158,121 @@ class ExecutionBounds:
 # Runtime
 # ---------------------------------------------------------------------------
 
+# ═══════════════════════════════════════════════════════════════════════════
+# Parallel higher-order builtins
+# ═══════════════════════════════════════════════════════════════════════════
+# Scoring pipelines map a pure function over millions of rows on one core.
+# When the callback passes the JIT purity analysis (no free variables, no
+# side-effecting builtins, no FFI) and the data converts to plain Python,
+# filter/map_ can partition the input across a process pool and merge
+# results in order. reduce stays serial: associativity can't be assumed.
+
+_HOF_POOL = None
+
+PARALLEL_HOF_MIN_ITEMS = 2000
+
+
+def _hof_pool():
+    global _HOF_POOL
+    if _HOF_POOL is None:
+        import concurrent.futures
+        _HOF_POOL = concurrent.futures.ProcessPoolExecutor()
+    return _HOF_POOL
+
+
+def _parallel_chunk_worker(mode: str, name: str, params, body, chunk):
+    """Apply a pure TinyTalk function over one chunk (worker process)."""
+    rt = Runtime()
+    fn = TinyFunction(name, params, body, rt.global_scope)
+    out = []
+    for raw in chunk:
+        val = Runtime._jit_from_python(raw)
+        res = rt._call_function(fn, [val], rt.global_scope, 0)
+        out.append(Runtime._jit_to_python(res) if mode == 'map'
+                   else bool(res.is_truthy()))
+    return out
+
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# Binary-op specialization (inline caches)
+# ═══════════════════════════════════════════════════════════════════════════
+# _eval_binary re-inspects operand types on every evaluation. Each BinaryOp
+# site instead caches a specialized function for the operand types it last
+# saw; the function guards its types and returns None on mismatch, sending
+# the site back through the generic ladder (which re-specializes). Built
+# from observed type feedback rather than the static typechecker - the
+# checker's inference is too incomplete to trust for dispatch.
+
+def _build_binop_specs():
+    INT = ValueType.INT
+    FLOAT = ValueType.FLOAT
+    specs = {}
+
+    def arith(op_name, int_fn, float_fn):
+        def spec_ii(l, r):
+            if l.type is INT and r.type is INT:
+                return Value.int_val(int_fn(l.data, r.data))
+            return None
+
+        def spec_ff(l, r):
+            if l.type is FLOAT and r.type is FLOAT:
+                return Value.float_val(float_fn(l.data, r.data))
+            return None
+
+        specs[(op_name, INT, INT)] = spec_ii
+        specs[(op_name, FLOAT, FLOAT)] = spec_ff
+
+    arith('+', lambda a, b: a + b, lambda a, b: a + b)
+    arith('-', lambda a, b: a - b, lambda a, b: a - b)
+    arith('*', lambda a, b: a * b, lambda a, b: a * b)
+
+    def compare(op_name, fn):
+        def spec(l, r):
+            if l.type is INT and r.type is INT:
+                return Value.bool_val(fn(l.data, r.data))
+            return None
+        specs[(op_name, INT, INT)] = spec
+
+    compare('<', lambda a, b: a < b)
+    compare('>', lambda a, b: a > b)
+    compare('<=', lambda a, b: a <= b)
+    compare('>=', lambda a, b: a >= b)
+    compare('==', lambda a, b: a == b)
+    compare('!=', lambda a, b: a != b)
+
+    STRING = ValueType.STRING
+
+    def str_concat(l, r):
+        if l.type is STRING and r.type is STRING:
+            return Value.string_val(l.data + r.data)
+        return None
+
+    specs[('+', STRING, STRING)] = str_concat
+    return specs
+
+
+_BINOP_SPECS = _build_binop_specs()
+
+
 class Runtime:
-    def __init__(self, bounds: Optional[ExecutionBounds] = None, source_dir: str = ""):
+    def __init__(self, bounds: Optional[ExecutionBounds] = None, source_dir: str = "",
+                 sql_engine=None, parallel_hof: bool = False, jit: bool = False):
         self.bounds = bounds or ExecutionBounds()
         self.global_scope = Scope()
         self.structs: Dict[str, TinyStruct] = {}
         self.enums: Dict[str, TinyEnum] = {}
         self._source_dir = source_dir or os.getcwd()
         self._imported_modules: Dict[str, Scope] = {}
+        # Optional SQL pushdown engine (see sql_engine.py): step chains
+        # rooted at a registered table run in the database
+        self.sql_engine = sql_engine
+        # Opt-in process-pool execution for pure filter/map_ callbacks
+        self.parallel_hof = parallel_hof
+        # Opt-in JIT tier: compiled code performs no per-op bounds
+        # accounting, so ExecutionBounds only constrain interpreted code
+        # while this is on - hence off by default (see _jit_compile)
+        self.jit_enabled = jit
 
         # metrics
         self.op_count = 0
@@ -200,6 +311,10 @@ class Runtime:
         fn_val, items = args[0], args[1]
         if fn_val.type != ValueType.FUNCTION or items.type != ValueType.LIST:
             return Value.list_val([])
+        parallel = self._try_parallel_hof('filter', fn_val.data, items.data)
+        if parallel is not None:
+            return Value.list_val([item for item, keep in zip(items.data, parallel)
+                                   if keep])
         return Value.list_val([
             item for item in items.data
             if self._call_function(fn_val.data, [item], self.global_scope, 0).is_truthy()
@@ -211,11 +326,51 @@ class Runtime:
         fn_val, items = args[0], args[1]
         if fn_val.type != ValueType.FUNCTION or items.type != ValueType.LIST:
             return Value.list_val([])
+        parallel = self._try_parallel_hof('map', fn_val.data, items.data)
+        if parallel is not None:
+            return Value.list_val([self._jit_from_python(v) for v in parallel])
         return Value.list_val([
             self._call_function(fn_val.data, [item], self.global_scope, 0)
             for item in items.data
         ])
 
+    def _try_parallel_hof(self, mode: str, fn: TinyFunction, items: List[Value]):
+        """Run a pure callback over items via the process pool.
+
+        Returns per-item results (raw python values for 'map', booleans for
+        'filter') in input order, or None when the serial path must run:
+        parallelism disabled, input too small, callback native or impure,
+        or data not convertible to plain Python.
+        """
+        if not self.parallel_hof or len(items) < PARALLEL_HOF_MIN_ITEMS:
+            return None
+        if fn.is_native or fn.body is None or not self._jit_supported(fn):
+            return None
+        try:
+            raw = [self._jit_to_python(i) for i in items]
+        except ValueError:
+            return None
+        import os
+        workers = os.cpu_count() or 1
+        if workers < 2:
+            return None  # a one-worker pool is pure overhead
+        try:
+            pool = _hof_pool()
+            chunk_size = max(1, (len(raw) + workers - 1) // workers)
+            chunks = [raw[i:i + chunk_size] for i in range(0, len(raw), chunk_size)]
+            params = [(p[0], None) for p in fn.params]
+            futures = [
+                pool.submit(_parallel_chunk_worker, mode, fn.name, params,
+                            fn.body, chunk)
+                for chunk in chunks
+            ]
+            out = []
+            for future in futures:
+                out.extend(future.result())
+            return out
+        except Exception:
+            return None
+
     def _builtin_reduce(self, args: List[Value]) -> Value:
         if len(args) < 3:
             return Value.null_val()
@@ -265,6 +420,9 @@ class Runtime:
         if isinstance(node, Identifier):
             val = scope.get(node.name)
             if val is None:
+                if self.sql_engine is not None and self.sql_engine.has_table(node.name):
+                    # Table referenced outside a pushdown chain: materialize
+                    return self._sql_rows_to_value(self.sql_engine.fetch_table(node.name))
                 available = self._collect_names(scope)
                 raise TinyTalkError(
                     undefined_variable_hint(node.name, available), node.line
@@ -422,6 +580,17 @@ class Runtime:
     def _eval_binary(self, node: BinaryOp, scope: Scope) -> Value:
         op = node.op
 
+        # Inline cache: a specialized function installed for this site's
+        # observed operand types; guard failure falls back to the ladder
+        spec = node._spec
+        if spec is not None and op not in ('and', 'or'):
+            left = self._eval(node.left, scope)
+            right = self._eval(node.right, scope)
+            result = spec(left, right)
+            if result is not None:
+                return result
+            return self._eval_binary_generic(node, op, left, right)
+
         # Short-circuit
         if op == "and":
             left = self._eval(node.left, scope)
@@ -437,6 +606,11 @@ class Runtime:
 
         left = self._eval(node.left, scope)
         right = self._eval(node.right, scope)
+        return self._eval_binary_generic(node, op, left, right)
+
+    def _eval_binary_generic(self, node: BinaryOp, op: str, left: Value, right: Value) -> Value:
+        # Install (or re-install) the specialization for the types seen now
+        node._spec = _BINOP_SPECS.get((op, left.type, right.type))
 
         # Arithmetic
         if op == "+":
@@ -610,6 +784,25 @@ class Runtime:
         try:
             if fn.is_native:
                 return fn.native_fn(args)
+
+            # JIT tier (opt-in): hot functions dispatch to transpiled
+            # Python, with guard-based fallback to the interpreter on any
+            # mismatch
+            if not self.jit_enabled:
+                pass
+            elif fn.jit_fn is not None:
+                result = self._try_jit_call(fn, args)
+                if result is not None:
+                    return result
+            elif fn.jit_state == "cold":
+                fn.call_count += 1
+                if fn.call_count >= self.JIT_THRESHOLD:
+                    self._jit_compile(fn)
+                    if fn.jit_fn is not None:
+                        result = self._try_jit_call(fn, args)
+                        if result is not None:
+                            return result
+
             fn_scope = Scope(fn.closure)
             for i, param in enumerate(fn.params):
                 pname = param[0]
@@ -640,6 +833,149 @@ class Runtime:
         finally:
             self.recursion_depth -= 1
 
+    # -- JIT tier -----------------------------------------------------------
+    #
+    # Request handlers call the same few TinyTalk functions millions of
+    # times. Past JIT_THRESHOLD invocations, a function whose body is fully
+    # expressible in plain Python (checked below) is transpiled via
+    # PythonTranspiler, compiled, and future calls run the compiled form.
+    # Guards keep this safe: unconvertible arguments, runtime exceptions in
+    # compiled code, or unconvertible results all fall back to interpreting
+    # that call. Known semantic gaps: Python's exact float == replaces the
+    # interpreter's tolerant _equal (shared with the offline transpiler),
+    # and compiled code performs NO ops/iteration/deadline accounting -
+    # ExecutionBounds do not constrain a loop inside a compiled function.
+    # That is why the tier is strictly opt-in (Runtime(jit=True) /
+    # TinyTalkKernel(jit=True)), like parallel_hof.
+
+    JIT_THRESHOLD = 50
+
+    # Builtins whose transpiled Python form is pure and faithful
+    _JIT_SAFE_CALLS = frozenset((
+        'len', 'abs', 'round', 'min', 'max', 'sum', 'str', 'int', 'float',
+        'bool', 'range', 'sort', 'reverse', 'sqrt', 'floor', 'ceil', 'pow',
+        'contains', 'slice', 'keys', 'values',
+    ))
+
+    def _jit_compile(self, fn: TinyFunction):
+        """Attempt to compile a hot function; sets fn.jit_fn or marks it
+        unsupported so the check never repeats."""
+        fn.jit_state = "unsupported"
+        if not self._jit_supported(fn):
+            return
+        try:
+            import math
+
+            from .transpiler import PythonTranspiler
+            from .ast_nodes import FnDecl, Program as AstProgram
+
+            decl = FnDecl(name=fn.name, params=[(p[0], None) for p in fn.params],
+                          body=fn.body)
+            code_text = PythonTranspiler().emit(AstProgram(statements=[decl]))
+            namespace = {'math': math}
+            exec(compile(code_text, f"<jit:{fn.name}>", 'exec'), namespace)
+            fn.jit_fn = namespace[fn.name]
+            fn.jit_state = "compiled"
+        except Exception:
+            fn.jit_fn = None
+
+    def _jit_supported(self, fn: TinyFunction) -> bool:
+        """True when every construct, operator, and name in the body is
+        expressible in plain Python by the transpiler."""
+        from . import ast_nodes as N
+
+        allowed_nodes = (
+            N.Literal, N.Identifier, N.BinaryOp, N.UnaryOp, N.Call, N.Index,
+            N.Array, N.MapLiteral, N.Conditional, N.Range, N.StringInterp,
+            N.Block, N.IfStmt, N.ForStmt, N.WhileStmt, N.ReturnStmt,
+            N.LetStmt, N.ConstStmt, N.AssignStmt, N.BreakStmt, N.ContinueStmt,
+        )
+
+        defined = {p[0] for p in fn.params}
+        defined.add(fn.name)  # self-recursion compiles fine
+        used = set()
+        callees = set()
+
+        def walk(node):
+            if node is None:
+                return True
+            if not isinstance(node, allowed_nodes):
+                return False
+            if isinstance(node, N.Identifier):
+                used.add(node.name)
+            elif isinstance(node, (N.LetStmt, N.ConstStmt)):
+                defined.add(node.name)
+            elif isinstance(node, N.ForStmt):
+                defined.add(node.var)
+            elif isinstance(node, N.Call):
+                if not isinstance(node.callee, N.Identifier):
+                    return False
+                callees.add(node.callee.name)
+            for value in vars(node).values():
+                for child in _jit_children(value):
+                    if not walk(child):
+                        return False
+            return True
+
+        def _jit_children(value):
+            if hasattr(value, 'type') and hasattr(value, 'line'):
+                yield value
+            elif isinstance(value, (list, tuple)):
+                for item in value:
+                    yield from _jit_children(item)
+
+        if not walk(fn.body):
+            return False
+        if not callees <= (self._JIT_SAFE_CALLS | {fn.name}):
+            return False
+        free = used - defined - self._JIT_SAFE_CALLS
+        return not free
+
+    def _try_jit_call(self, fn: TinyFunction, args: List[Value]) -> Optional[Value]:
+        """Call the compiled form; None means 'interpret this call'."""
+        try:
+            py_args = [self._jit_to_python(a) for a in args]
+        except ValueError:
+            return None
+        # Missing arguments default to null, as in the interpreter
+        while len(py_args) < len(fn.params):
+            py_args.append(None)
+        self.op_count += 1
+        try:
+            result = fn.jit_fn(*py_args)
+            return self._jit_from_python(result)
+        except Exception:
+            return None
+
+    @staticmethod
+    def _jit_to_python(v: Value):
+        if v.type in (ValueType.INT, ValueType.FLOAT, ValueType.STRING,
+                      ValueType.BOOLEAN, ValueType.NULL):
+            return v.data
+        if v.type == ValueType.LIST:
+            return [Runtime._jit_to_python(i) for i in v.data]
+        if v.type == ValueType.MAP:
+            return {k: Runtime._jit_to_python(i) for k, i in v.data.items()}
+        raise ValueError(f"not JIT-convertible: {v.type}")
+
+    @staticmethod
+    def _jit_from_python(v) -> Value:
+        if v is None:
+            return Value.null_val()
+        if isinstance(v, bool):
+            return Value.bool_val(v)
+        if isinstance(v, int):
+            return Value.int_val(v)
+        if isinstance(v, float):
+            return Value.float_val(v)
+        if isinstance(v, str):
+            return Value.string_val(v)
+        if isinstance(v, (list, tuple, range)):
+            return Value.list_val([Runtime._jit_from_python(i) for i in v])
+        if isinstance(v, dict):
+            return Value.map_val({k: Runtime._jit_from_python(i) for k, i in v.items()})
+        raise ValueError(f"not JIT-convertible result: {type(v)}")
+
     def _call_bound_method(self, bound: BoundMethod, args: List[Value], scope: Scope, line: int) -> Value:
         self.recursion_depth += 1
         if self.recursion_depth > self.bounds.max_recursion:
@@ -1053,12 +1389,49 @@ class Runtime:
     # -- step chains --------------------------------------------------------
 
     def _eval_step_chain(self, node: StepChain, scope: Scope) -> Value:
+        # SQL pushdown: a chain rooted at a registered table (and not
+        # shadowed by a script variable) whose verbs are all expressible in
+        # SQL runs in the database; anything else falls back to the
+        # interpreter below
+        engine = self.sql_engine
+        if engine is not None and isinstance(node.source, Identifier) \
+                and scope.get(node.source.name) is None \
+                and engine.can_push_down(node):
+            try:
+                shape, payload = engine.execute_chain(node)
+            except Exception:
+                pass  # guard failure: interpret instead
+            else:
+                if shape == 'scalar':
+                    return self._python_to_value(payload)
+                if shape == 'column':
+                    return Value.list_val([self._python_to_value(v) for v in payload])
+                return self._sql_rows_to_value(payload)
+
         data = self._eval(node.source, scope)
         for step_name, step_args in node.steps:
             args = [self._eval(a, scope) for a in step_args]
             data = self._apply_step(data, step_name, args, scope, node.line)
         return data
 
+    @staticmethod
+    def _python_to_value(v) -> Value:
+        if v is None:
+            return Value.null_val()
+        if isinstance(v, bool):
+            return Value.bool_val(v)
+        if isinstance(v, int):
+            return Value.int_val(v)
+        if isinstance(v, float):
+            return Value.float_val(v)
+        return Value.string_val(str(v))
+
+    def _sql_rows_to_value(self, rows) -> Value:
+        return Value.list_val([
+            Value.map_val({k: self._python_to_value(v) for k, v in row.items()})
+            for row in rows
+        ])
+
     def _apply_step(self, data: Value, step: str, args: List[Value], scope: Scope, line: int) -> Value:
         # Steps that work on maps directly (before list conversion)
         if step == "_mapValues":
@@ -0,0 +1,237 @@
+"""
+TinyTalk → SQL Pushdown Engine
+
+The sql_transpiler only emits SQL text; this module executes it. Step chains
+rooted at a registered table are routed through the transpiler to a live
+SQLite connection instead of running element-by-element in the interpreter,
+so large filters and group-bys happen in the database.
+
+Usage:
+    from newTinyTalk import TinyTalkKernel
+    from newTinyTalk.sql_engine import SQLEngine
+
+    engine = SQLEngine()                        # in-memory, or a db path
+    engine.register_table("people", [{"name": "Ada", "age": 36}, ...])
+    kernel = TinyTalkKernel(sql_engine=engine)
+    kernel.run('people _filter((r) => r["age"] > 30) _count')
+
+The runtime falls back to interpreted evaluation whenever a chain uses a
+verb or argument shape the transpiler cannot express, so pushdown is purely
+an optimization.
+"""
+
+import sqlite3
+import threading
+from typing import Any, Dict, List, Optional, Tuple
+
+from .ast_nodes import Identifier, Lambda, Literal, MapLiteral, StepChain
+from .sql_transpiler import SQLTranspiler
+
+
+def _nodes_in(value):
+    """Yield AST nodes found in a field value (node, or nested list/tuple)."""
+    if hasattr(value, 'type') and hasattr(value, 'line'):
+        yield value
+    elif isinstance(value, (list, tuple)):
+        for item in value:
+            yield from _nodes_in(item)
+
+
+def _closed_over(node, allowed: frozenset) -> bool:
+    """True when every identifier in a subtree names a lambda parameter."""
+    if isinstance(node, Identifier):
+        return node.name in allowed
+    if isinstance(node, Lambda):
+        allowed = allowed | frozenset(node.params)
+        node = node.body
+        return _closed_over(node, allowed)
+    for value in vars(node).values():
+        for child in _nodes_in(value):
+            if not _closed_over(child, allowed):
+                return False
+    return True
+
+
+def _lambdas_closed(step_args) -> bool:
+    """Every lambda anywhere in a step's arguments is closed (references
+    only its own, possibly nested, parameters)."""
+    return all(
+        _closed_over(node, frozenset())
+        for arg in step_args
+        for node in _walk_lambdas(arg)
+    )
+
+
+def _walk_lambdas(node):
+    """Yield the outermost lambdas in a subtree (nested ones are covered
+    by _closed_over itself)."""
+    if isinstance(node, Lambda):
+        yield node
+        return
+    for value in vars(node).values():
+        for child in _nodes_in(value):
+            yield from _walk_lambdas(child)
+
+
+class SQLEngine:
+    """Executes pushdown-eligible step chains against SQLite."""
+
+    # Verbs the transpiler expresses with interpreter-identical results.
+    # Excluded on purpose: bare _sum/_avg/_min/_max (the transpiler emits
+    # SUM(*), not valid SQL), _sort/_distinct/_unique (the interpreter
+    # errors on row maps, and pushdown must never accept what interpreted
+    # evaluation rejects), and _rename (SQL's 'SELECT *, old AS new' keeps
+    # the original column; the interpreter renames in place).
+    PUSHDOWN_STEPS = frozenset((
+        '_filter', '_select', '_group', '_groupBy', '_group_by', '_summarize',
+        '_arrange', '_sortBy', '_take', '_drop',
+        '_count', '_pull',
+    ))
+
+    def __init__(self, db_path: str = ":memory:", statement_cache: int = 256):
+        self.db_path = db_path
+        self._statement_cache = statement_cache
+        self._tables: Dict[str, List[str]] = {}  # name -> column order
+        self._lock = threading.Lock()
+        self._local = threading.local()
+        if db_path == ":memory:":
+            # One shared in-memory database; guarded by the lock
+            self._shared_conn = self._connect()
+        else:
+            self._shared_conn = None
+
+    def _connect(self) -> sqlite3.Connection:
+        conn = sqlite3.connect(
+            self.db_path,
+            check_same_thread=False,
+            cached_statements=self._statement_cache,  # prepared-stmt reuse
+        )
+        conn.row_factory = sqlite3.Row
+        return conn
+
+    def _conn(self) -> sqlite3.Connection:
+        if self._shared_conn is not None:
+            return self._shared_conn
+        conn = getattr(self._local, 'conn', None)
+        if conn is None:
+            conn = self._connect()
+            self._local.conn = conn
+        return conn
+
+    # -- table registry -----------------------------------------------------
+
+    def register_table(self, name: str, rows: List[Dict[str, Any]]):
+        """Create (or replace) a table from a list of row dicts."""
+        if not name.isidentifier():
+            raise ValueError(f"Invalid table name: {name}")
+        columns: List[str] = []
+        for row in rows:
+            for col in row:
+                if col not in columns:
+                    columns.append(col)
+        if not all(str(c).isidentifier() for c in columns):
+            raise ValueError("Column names must be identifiers")
+        with self._lock:
+            conn = self._conn()
+            conn.execute(f'DROP TABLE IF EXISTS "{name}"')
+            cols_sql = ", ".join(f'"{c}"' for c in columns) or '"_empty"'
+            conn.execute(f'CREATE TABLE "{name}" ({cols_sql})')
+            if rows and columns:
+                placeholders = ", ".join("?" for _ in columns)
+                conn.executemany(
+                    f'INSERT INTO "{name}" VALUES ({placeholders})',
+                    [tuple(row.get(c) for c in columns) for row in rows])
+            conn.commit()
+            self._tables[name] = columns
+
+    def attach_existing(self, name: str):
+        """Register a table that already exists in the database file."""
+        cur = self._conn().execute(f'SELECT * FROM "{name}" LIMIT 0')
+        self._tables[name] = [d[0] for d in cur.description]
+
+    def has_table(self, name: str) -> bool:
+        return name in self._tables
+
+    def fetch_table(self, name: str) -> List[Dict[str, Any]]:
+        """All rows of a table as dicts (interpreter fallback path)."""
+        with self._lock:
+            cur = self._conn().execute(f'SELECT * FROM "{name}"')
+            return [dict(r) for r in cur.fetchall()]
+
+    # -- pushdown -----------------------------------------------------------
+
+    def can_push_down(self, chain: StepChain) -> bool:
+        """True when every verb and argument shape is expressible in SQL
+        AND accepted identically by the interpreter."""
+        if not isinstance(chain.source, Identifier):
+            return False
+        if chain.source.name not in self._tables:
+            return False
+        group_at = summarize_at = None
+        for idx, (step_name, step_args) in enumerate(chain.steps):
+            if step_name not in self.PUSHDOWN_STEPS:
+                return False
+            if step_name in ('_take', '_drop', '_pull'):
+                if not (step_args and isinstance(step_args[0], Literal)):
+                    return False
+            if step_name in ('_group', '_groupBy', '_group_by'):
+                group_at = idx
+            if step_name == '_summarize':
+                if not (step_args and isinstance(step_args[0], MapLiteral)):
+                    return False
+                summarize_at = idx
+            # Lambdas are emitted with bare identifiers: a captured
+            # enclosing-scope variable would silently read a column of the
+            # same name, so every lambda must be closed over its own params
+            if not _lambdas_closed(step_args):
+                return False
+        # SQL GROUP BY only matches interpreter semantics when the grouping
+        # is consumed by a _summarize in the same chain (a bare _group
+        # yields a map of groups in the interpreter, not collapsed rows) -
+        # and _summarize needs a grouping to aggregate over
+        if (group_at is None) != (summarize_at is None):
+            return False
+        if group_at is not None and group_at > summarize_at:
+            return False
+        return True
+
+    def execute_chain(self, chain: StepChain) -> Tuple[str, Any]:
+        """Run a pushdown-eligible chain; returns (shape, payload).
+
+        shape is 'rows' (list of dicts), 'column' (list of scalars), or
+        'scalar'. Raises on SQL the transpiler could not express cleanly -
+        callers treat any exception as "fall back to the interpreter".
+        """
+        # Transpiled fresh per execution: the engine outlives per-run ASTs,
+        # so caching on node identity would serve a freed node's SQL to a
+        # new chain that reuses its id. sqlite3's cached_statements already
+        # amortizes the expensive part (statement preparation).
+        sql = SQLTranspiler()._emit_step_chain(chain)
+        if '?' in sql:
+            # The transpiler marks inexpressible fragments with '?'
+            raise ValueError("chain not fully expressible in SQL")
+
+        step_names = [s for s, _ in chain.steps]
+        with self._lock:
+            cur = self._conn().execute(sql.rstrip(';'))
+            rows = cur.fetchall()
+
+        grouped = any(s in ('_group', '_groupBy', '_group_by') for s in step_names)
+        if '_count' in step_names and not grouped:
+            return 'scalar', (rows[0][0] if rows else 0)
+        if '_pull' in step_names:
+            return 'column', [r[0] for r in rows]
+        if grouped:
+            # Match the interpreter's _summarize rows, which carry only the
+            # aggregation aliases (not the group key)
+            aliases = None
+            for step_name, step_args in chain.steps:
+                if step_name == '_summarize':
+                    aliases = [k.value for k, _ in step_args[0].pairs
+                               if isinstance(k, Literal)]
+            if aliases:
+                return 'rows', [
+                    {k: v for k, v in dict(r).items() if k in aliases}
+                    for r in rows
+                ]
+        return 'rows', [dict(r) for r in rows]
@@ -0,0 +1,110 @@
+"""
+Tests for the SQL pushdown engine.
+Pushed chains must match the interpreter's results exactly.
+"""
+
+import pytest
+from newTinyTalk import TinyTalkKernel
+from newTinyTalk.sql_engine import SQLEngine
+
+ROWS = [
+    {"name": "Ada", "age": 36, "dept": "eng"},
+    {"name": "Grace", "age": 45, "dept": "eng"},
+    {"name": "Alan", "age": 41, "dept": "math"},
+    {"name": "Edsger", "age": 29, "dept": "math"},
+]
+
+INLINE = "let people = " + repr(ROWS).replace("'", '"') + "\n"
+
+
+@pytest.fixture
+def pushdown_kernel():
+    engine = SQLEngine()
+    engine.register_table("people", ROWS)
+    return TinyTalkKernel(sql_engine=engine)
+
+
+def both(pushdown_kernel, src: str):
+    pushed = pushdown_kernel.run(src)
+    interpreted = TinyTalkKernel().run(INLINE + src)
+    return pushed, interpreted
+
+
+class TestPushdownParity:
+    @pytest.mark.parametrize("src", [
+        'show(people _filter((r) => r["age"] > 30) _count)',
+        'show(people _filter((r) => r["dept"] == "eng") _select("name"))',
+        'show(people _pull("name"))',
+        'show(people _take(2))',
+        'show(people _drop(2) _select("name"))',
+        'show(people _filter((r) => r["age"] > 100) _count)',
+        'show(people _group((r) => r["dept"])'
+        ' _summarize({"avg_age": (rows) => rows _map((r) => r["age"]) _avg}))',
+    ])
+    def test_matches_interpreter(self, pushdown_kernel, src):
+        pushed, interpreted = both(pushdown_kernel, src)
+        assert pushed.success and interpreted.success
+        assert pushed.output == interpreted.output
+
+    def test_unsupported_verb_falls_back(self, pushdown_kernel):
+        # _map with a lambda is not pushable; the table materializes
+        pushed, interpreted = both(
+            pushdown_kernel, 'show(people _map((r) => r["age"] * 2) _sum)')
+        assert pushed.output == interpreted.output
+
+    def test_script_variable_shadows_table(self, pushdown_kernel):
+        r = pushdown_kernel.run('let people = [{"age": 1}]\nshow(people _count)')
+        assert r.output.strip() == "1"
+
+    def test_alternating_chains_never_cross(self, pushdown_kernel):
+        # Regression: an id()-keyed SQL cache served a freed chain's SQL to
+        # a new chain reusing its id
+        for _ in range(50):
+            assert pushdown_kernel.run(
+                'show(people _filter((r) => r["age"] > 30) _count)'
+            ).output.strip() == "3"
+            assert pushdown_kernel.run(
+                'show(people _filter((r) => r["age"] > 40) _count)'
+            ).output.strip() == "2"
+
+    def test_captured_variable_falls_back(self, pushdown_kernel):
+        # A lambda referencing an enclosing variable must not push down:
+        # the bare name would silently read a column of the same name
+        src = 'let age = 10\nshow(people _filter((r) => r["age"] > age) _count)'
+        pushed = pushdown_kernel.run(src)
+        interpreted = TinyTalkKernel().run('let age = 10\n' + INLINE + src.split('\n', 1)[1])
+        assert pushed.output == interpreted.output
+
+    @pytest.mark.parametrize("verb", ['_sort', '_distinct', '_unique', '_rename({"name": "n"})'])
+    def test_interpreter_divergent_verbs_not_pushed(self, pushdown_kernel, verb):
+        # Verbs the interpreter rejects (or treats differently) on row maps
+        # must behave identically whether or not a table is registered
+        src = f'show(people {verb})'
+        pushed = pushdown_kernel.run(src)
+        interpreted = TinyTalkKernel().run(INLINE + src)
+        assert pushed.success == interpreted.success
+        assert pushed.output == interpreted.output
+
+    def test_bare_group_is_not_pushed(self):
+        # _group without _summarize yields a map of groups in the
+        # interpreter; SQL GROUP BY would collapse rows, so it must fall back
+        engine = SQLEngine()
+        engine.register_table("people", ROWS)
+        from newTinyTalk.lexer import Lexer
+        from newTinyTalk.parser import Parser
+        ast = Parser(Lexer('people _group((r) => r["dept"])').tokenize()).parse()
+        chain = ast.statements[0]
+        assert not engine.can_push_down(chain)
+
+
+class TestEngine:
+    def test_register_and_fetch(self):
+        engine = SQLEngine()
+        engine.register_table("t", [{"a": 1}, {"a": 2}])
+        assert engine.has_table("t")
+        assert engine.fetch_table("t") == [{"a": 1}, {"a": 2}]
+
+    def test_invalid_table_name_rejected(self):
+        engine = SQLEngine()
+        with pytest.raises(ValueError):
+            engine.register_table("bad name; DROP", [{"a": 1}])
@@ -8,6 +8,7 @@ import io
 import contextlib
 
 from newTinyTalk import TinyTalkKernel, transpile, transpile_pandas
+from newTinyTalk.transpiler import _STREAM_HELPERS, transpile_pandas_streaming
 
 
 # ---------------------------------------------------------------------------
@@ -410,3 +411,87 @@ class TestPandasMode:
     def test_rolling(self):
         py = transpile_pandas("data _window(3, avg_fn)")
         assert ".rolling(3)" in py
+
+
+# ---------------------------------------------------------------------------
+# Streaming pandas mode tests (structural — chunked code is generated)
+# ---------------------------------------------------------------------------
+
+class TestStreamingPandasMode:
+    def test_streamable_chain_emits_chunked_reader(self):
+        py = transpile_pandas_streaming(
+            'let out = read_csv("big.csv") _filter((r) => r["v"] > 50)'
+            ' _select("v") _take(1000)')
+        assert 'pd.read_csv("big.csv", chunksize=100000)' in py
+        assert "_tt_take_chunks" in py
+        compile(py, "<emitted>", "exec")  # emitted code must be valid Python
+
+    def test_chunksize_is_configurable(self):
+        py = transpile_pandas_streaming(
+            'let out = read_csv("big.csv") _filter((r) => r["v"] > 0)',
+            chunksize=5000)
+        assert "chunksize=5000" in py
+
+    def test_group_summarize_emits_two_phase_specs(self):
+        py = transpile_pandas_streaming(
+            'let s = read_csv("big.csv")'
+            ' _group((r) => r["dept"])'
+            ' _summarize({"avg_v": (rows) => rows _map((r) => r["v"]) _avg,'
+            '             "n": (rows) => rows _count})')
+        assert "_tt_group_agg" in py
+        # avg decomposes to mean (sum+count inside the helper); bare count
+        # aggregates over the group itself
+        assert '("avg_v", "v", "mean")' in py
+        assert '("n", "*", "count")' in py
+        compile(py, "<emitted>", "exec")
+
+    def test_bare_count_streams_without_materializing(self):
+        py = transpile_pandas_streaming(
+            'let n = read_csv("big.csv") _filter((r) => r["v"] > 50) _count')
+        assert "sum(len(_c)" in py
+        assert "pd.concat" not in py
+
+    def test_unsupported_verb_falls_back_to_whole_frame(self):
+        py = transpile_pandas_streaming(
+            'let x = read_csv("big.csv") _sort((r) => r["v"])')
+        assert "chunksize" not in py
+        assert "pd.DataFrame" in py
+
+    def test_non_csv_source_falls_back(self):
+        py = transpile_pandas_streaming('let x = data _filter((r) => r["v"] > 1)')
+        assert "chunksize" not in py
+
+    def test_plain_pandas_mode_unchanged(self):
+        py = transpile_pandas('let x = data _filter((r) => r["v"] > 1)')
+        assert "chunksize" not in py
+
+    def test_take_helper_short_circuits(self):
+        # The emitted helper is plain Python; exercise its trimming and
+        # short-circuit behavior with stub chunks
+        ns = {}
+        exec(_STREAM_HELPERS["_tt_take_chunks"], ns)
+        take = ns["_tt_take_chunks"]
+
+        class Chunk:
+            def __init__(self, rows):
+                self.rows = rows
+
+            def __len__(self):
+                return len(self.rows)
+
+            def head(self, n):
+                return Chunk(self.rows[:n])
+
+        consumed = []
+
+        def chunks():
+            for i in range(100):
+                consumed.append(i)
+                yield Chunk(list(range(10)))
+
+        out = list(take(chunks(), 25))
+        assert sum(len(c) for c in out) == 25
+        assert len(consumed) == 3  # stopped reading the source after 3 chunks
+
+    def test_group_agg_helper_source_is_valid(self):
+        compile(_STREAM_HELPERS["_tt_group_agg"], "<helper>", "exec")
@@ -115,11 +115,17 @@ _OP_MAP = {
 class PythonTranspiler:
     """Transpiles TinyTalk AST to plain Python code."""
 
-    def __init__(self, pandas_mode: bool = False):
+    def __init__(self, pandas_mode: bool = False, streaming: bool = False,
+                 chunksize: int = 100_000):
         self.pandas_mode = pandas_mode
+        # Streaming mode (pandas_mode only): read_csv-rooted chains emit
+        # chunked execution so data size is bounded by chunksize, not RAM
+        self.streaming = streaming
+        self.chunksize = chunksize
         self._indent = 0
         self._lines: list[str] = []
         self._imports: set[str] = set()
+        self._helpers: set[str] = set()
 
     def transpile(self, source: str) -> str:
         """Parse and transpile TinyTalk source to Python."""
@@ -141,12 +147,15 @@ class PythonTranspiler:
         else:
             self._lines.append(self._emit_expr(node))
 
-        # Build final output with imports
+        # Build final output with imports and any streaming helpers
         parts = []
         if self._imports:
             for imp in sorted(self._imports):
                 parts.append(imp)
             parts.append("")
+        for helper in sorted(self._helpers):
+            parts.append(_STREAM_HELPERS[helper].rstrip())
+            parts.append("")
         parts.extend(self._lines)
         return "\n".join(parts)
 
@@ -468,6 +477,10 @@ class PythonTranspiler:
 
     def _emit_step_chain(self, node: StepChain) -> str:
         if self.pandas_mode:
+            if self.streaming:
+                streamed = self._emit_streaming_chain(node)
+                if streamed is not None:
+                    return streamed
             return self._emit_pandas_chain(node)
         return self._emit_python_chain(node)
 
@@ -653,6 +666,103 @@ class PythonTranspiler:
 
         return f"<unknown_step:{step}>({data})"
 
+
+    # -------------------------------------------------------------------
+    # Streaming pandas mode: chunked execution for read_csv pipelines
+    # -------------------------------------------------------------------
+
+    _STREAM_VERBS = frozenset(("_filter", "_select", "_mutate", "_take"))
+    _STREAM_AGGS = {"_sum": "sum", "_avg": "mean", "_min": "min",
+                    "_max": "max", "_count": "count"}
+
+    def _emit_streaming_chain(self, node: StepChain):
+        """Emit a chunked pipeline, or None when the chain is not streamable.
+
+        Streamable chains are rooted at read_csv(...) and use only
+        element-wise verbs (filter/select/mutate/take), optionally ending in
+        a _group + _summarize pair (two-phase partial aggregation with spill
+        to disk) or a bare _count. Anything else falls back to whole-frame
+        emission.
+        """
+        if not (isinstance(node.source, Call)
+                and isinstance(node.source.callee, Identifier)
+                and node.source.callee.name == "read_csv"
+                and node.source.args):
+            return None
+
+        steps = list(node.steps)
+        group_spec = None
+        terminal = None
+
+        # Peel a trailing _group + _summarize or a bare _count terminal
+        if len(steps) >= 2 and steps[-2][0] in ("_group", "_groupBy", "_group_by") \
+                and steps[-1][0] == "_summarize":
+            specs = self._stream_agg_specs(steps[-1][1])
+            if specs is None:
+                return None
+            group_spec = (self._emit_expr(steps[-2][1][0]), specs)
+            steps = steps[:-2]
+        elif steps and steps[-1][0] == "_count" and not steps[-1][1]:
+            terminal = "_count"
+            steps = steps[:-1]
+
+        if not all(s in self._STREAM_VERBS for s, _ in steps):
+            return None
+
+        self._imports.add("import pandas as pd")
+        path = self._emit_expr(node.source.args[0])
+        gen = f"pd.read_csv({path}, chunksize={self.chunksize})"
+
+        for step_name, step_args in steps:
+            args = [self._emit_expr(a) for a in step_args]
+            if step_name == "_filter":
+                gen = f"(_c[_c.apply({args[0]}, axis=1)] for _c in {gen})"
+            elif step_name == "_select":
+                cols = args[0] if len(args) == 1 else "[" + ", ".join(args) + "]"
+                gen = f"(_c[{cols}] for _c in {gen})"
+            elif step_name == "_mutate":
+                gen = (f"(_c.assign(**_c.apply({args[0]}, axis=1, "
+                       f"result_type='expand')) for _c in {gen})")
+            elif step_name == "_take":
+                self._helpers.add("_tt_take_chunks")
+                gen = f"_tt_take_chunks({gen}, {args[0]})"
+
+        if group_spec is not None:
+            key_fn, specs = group_spec
+            self._helpers.add("_tt_group_agg")
+            specs_src = "[" + ", ".join(
+                f'("{alias}", "{col}", "{agg}")' for alias, col, agg in specs) + "]"
+            return f"_tt_group_agg({gen}, {key_fn}, {specs_src})"
+        if terminal == "_count":
+            return f"sum(len(_c) for _c in {gen})"
+        return f"pd.concat(list({gen}), ignore_index=True)"
+
+    def _stream_agg_specs(self, summarize_args):
+        """Extract (alias, column, agg) triples from a _summarize map whose
+        values look like (rows) => rows _map((r) => r["col"]) _agg."""
+        if not (summarize_args and isinstance(summarize_args[0], MapLiteral)):
+            return None
+        specs = []
+        for k, v in summarize_args[0].pairs:
+            if not (isinstance(k, Literal) and isinstance(v, Lambda)
+                    and isinstance(v.body, StepChain)):
+                return None
+            col = None
+            agg = None
+            for step_name, step_args in v.body.steps:
+                if step_name == "_map" and step_args and isinstance(step_args[0], Lambda):
+                    body = step_args[0].body
+                    if isinstance(body, Index) and isinstance(body.index, Literal):
+                        col = body.index.value
+                elif step_name in self._STREAM_AGGS:
+                    agg = self._STREAM_AGGS[step_name]
+            if agg == "count" and col is None:
+                col = "*"
+            if col is None or agg is None:
+                return None
+            specs.append((k.value, col, agg))
+        return specs or None
+
     # -------------------------------------------------------------------
     # Pandas mode: step chains → DataFrame operations
     # -------------------------------------------------------------------
@@ -809,3 +919,87 @@ def transpile(source: str) -> str:
 def transpile_pandas(source: str) -> str:
     """Transpile TinyTalk source to Python with pandas DataFrames."""
     return PythonTranspiler(pandas_mode=True).transpile(source)
+
+
+# ---------------------------------------------------------------------------
+# Streaming-mode helper sources (emitted into transpiled output on demand)
+# ---------------------------------------------------------------------------
+
+_STREAM_HELPERS = {
+    "_tt_take_chunks": '''
+def _tt_take_chunks(chunks, n):
+    """Yield chunks trimmed to the first n rows total (short-circuits)."""
+    remaining = n
+    for chunk in chunks:
+        if remaining <= 0:
+            break
+        if len(chunk) > remaining:
+            yield chunk.head(remaining)
+            break
+        remaining -= len(chunk)
+        yield chunk
+''',
+    "_tt_group_agg": '''
+def _tt_group_agg(chunks, key_fn, specs, spill_rows=2_000_000):
+    """Two-phase grouped aggregation over chunks with spill to disk.
+
+    specs: (alias, column, agg) with agg in sum/mean/min/max/count. Partial
+    per-chunk aggregates accumulate in memory and spill to pickle files past
+    spill_rows, so group cardinality - not data size - bounds memory.
+    """
+    import os
+    import tempfile
+
+    def _partial(df):
+        grouped = df.groupby(df.apply(key_fn, axis=1))
+        out = {}
+        for alias, col, agg in specs:
+            series = grouped[col] if col != "*" else grouped.size()
+            if agg == "mean":
+                out[alias + "__sum"] = series.sum()
+                out[alias + "__n"] = series.count()
+            elif agg == "count":
+                out[alias] = series.count() if col != "*" else series
+            else:
+                out[alias] = getattr(series, agg)()
+        return pd.DataFrame(out)
+
+    partials = []
+    spilled = []
+    rows = 0
+    for chunk in chunks:
+        part = _partial(chunk)
+        partials.append(part)
+        rows += len(part)
+        if rows >= spill_rows:
+            handle = tempfile.NamedTemporaryFile(delete=False, suffix=".pkl")
+            handle.close()
+            pd.concat(partials).to_pickle(handle.name)
+            spilled.append(handle.name)
+            partials = []
+            rows = 0
+
+    frames = partials + [pd.read_pickle(p) for p in spilled]
+    for p in spilled:
+        os.unlink(p)
+    if not frames:
+        return pd.DataFrame()
+    merged = pd.concat(frames)
+    grouped = merged.groupby(level=0)
+    out = {}
+    for alias, col, agg in specs:
+        if agg == "mean":
+            out[alias] = grouped[alias + "__sum"].sum() / grouped[alias + "__n"].sum()
+        elif agg in ("sum", "count"):
+            out[alias] = grouped[alias].sum()
+        else:
+            out[alias] = getattr(grouped[alias], agg)()
+    return pd.DataFrame(out)
+''',
+}
+
+
+def transpile_pandas_streaming(source: str, chunksize: int = 100_000) -> str:
+    """Transpile to chunked pandas execution for larger-than-memory data."""
+    return PythonTranspiler(pandas_mode=True, streaming=True,
+                            chunksize=chunksize).transpile(source)
@@ -14,25 +14,38 @@ The trace IS the proof.
 __version__ = "1.0.0"
 __author__ = "Newton Supercomputer"
 
-from .kernel import TinyTalkKernel, ExecutionBounds, Trace, Ledger, fin, finfr
+from .kernel import TinyTalkKernel, ExecutionBounds, Trace, TracePolicy, Ledger, fin, finfr
 from .lexer import Lexer, Token, TokenType
 from .parser import Parser, Program, Literal, Identifier, BinaryOp, UnaryOp
 from .types import Value, ValueType, TinyType, TypeChecker
 from .runtime import Runtime, Scope, TinyFunction, TinyTalkError
-from .ffi import (
-    FFIConfig, configure_ffi, 
-    to_python, from_python, wrap_python_function,
-    import_python, import_builtin, import_external,
-    call_javascript, call_go, call_rust, call_shell,
-    http_get, http_post
-)
 from .stdlib import STDLIB_FUNCTIONS, STDLIB_CONSTANTS
 
+# FFI exports resolve lazily (PEP 562): the module pulls in subprocess and
+# inspect, a measurable slice of serverless cold start, and most runs never
+# touch the FFI.
+_FFI_EXPORTS = (
+    'FFIConfig', 'configure_ffi',
+    'to_python', 'to_python_lazy', 'from_python', 'wrap_python_function',
+    'LazyListProxy', 'LazyMapProxy',
+    'import_python', 'import_builtin', 'import_external',
+    'call_javascript', 'call_go', 'call_rust', 'call_shell',
+    'http_get', 'http_post',
+)
+
+
+def __getattr__(name):
+    if name in _FFI_EXPORTS:
+        from . import ffi
+        return getattr(ffi, name)
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
 __all__ = [
     # Kernel
     'TinyTalkKernel',
     'ExecutionBounds',
     'Trace',
+    'TracePolicy',
     'Ledger',
     'fin',
     'finfr',
@@ -84,13 +97,20 @@ __all__ = [
 ]
 
 
-def run(source: str, bounds: ExecutionBounds = None) -> Value:
-    """Run TinyTalk source code."""
+def run(source: str, bounds: ExecutionBounds = None, engine: str = 'ast') -> Value:
+    """Run TinyTalk source code.
+
+    engine='ast' walks the tree directly; engine='vm' lowers the AST to
+    bytecode first (see vm.py) - much faster for loop-heavy scripts.
+    """
     lexer = Lexer(source)
     tokens = lexer.tokenize()
     parser = Parser(tokens)
     ast = parser.parse()
     runtime = Runtime(bounds)
+    if engine == 'vm':
+        from .vm import compile_program
+        return runtime.execute_code(compile_program(ast))
     return runtime.execute(ast)
 
 
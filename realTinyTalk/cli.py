@@ -22,11 +22,27 @@ sys.path.insert(0, str(Path(__file__).parent.parent))
 
 def cmd_run(args):
     """Run a tinyTalk file."""
-    from realTinyTalk import run
-    
     source = Path(args.file).read_text(encoding='utf-8')
+
+    if getattr(args, 'profile', False):
+        import json
+
+        from realTinyTalk.lexer import Lexer
+        from realTinyTalk.parser import Parser
+        from realTinyTalk.runtime import Runtime
+
+        runtime = Runtime()
+        runtime.enable_profiling()
+        result = runtime.execute(Parser(Lexer(source).tokenize()).parse())
+        if result is not None and not args.quiet:
+            print(result)
+        # Profile goes to stderr so program output stays clean
+        print(json.dumps(runtime.profiler.report(), indent=2), file=sys.stderr)
+        return
+
+    from realTinyTalk import run
     result = run(source)
-    
+
     if result is not None and not args.quiet:
         print(result)
 
@@ -119,6 +135,8 @@ Examples:
     run_parser = subparsers.add_parser('run', help='Run a .tt file')
     run_parser.add_argument('file', help='File to run')
     run_parser.add_argument('-q', '--quiet', action='store_true', help='Suppress result output')
+    run_parser.add_argument('--profile', action='store_true',
+                            help='Print a JSON execution profile to stderr')
     
     # build command
     build_parser = subparsers.add_parser('build', help='Compile to target language')
@@ -7,6 +7,7 @@ Python, JavaScript, Rust, C, Go, and more.
 ═══════════════════════════════════════════════════════════════════════════════
 """
 
+from collections.abc import Mapping, Sequence
 from dataclasses import dataclass
 from typing import Any, Dict, List, Optional, Callable
 import importlib
@@ -57,7 +58,13 @@ def configure_ffi(config: FFIConfig):
 # ═══════════════════════════════════════════════════════════════════════════════
 
 def to_python(value: Value) -> Any:
-    """Convert TinyTalk value to Python."""
+    """Convert TinyTalk value to Python (eager deep conversion).
+
+    Serialization boundaries (json.dumps for the JS/Go/Rust bridges) need
+    real lists and dicts, so this stays eager; in-process Python helpers
+    should prefer to_python_lazy, which defers element conversion until
+    access.
+    """
     if value.type == ValueType.NULL:
         return None
     if value.type == ValueType.LIST:
@@ -67,10 +74,72 @@ def to_python(value: Value) -> Any:
     return value.data
 
 
+class LazyListProxy(Sequence):
+    """Read-only Python sequence over TinyTalk list data.
+
+    Elements convert on access, so passing a large list to a helper that
+    reads a few items costs O(reads) instead of O(n) both ways.
+    """
+
+    __slots__ = ('_items',)
+
+    def __init__(self, items: List[Value]):
+        self._items = items
+
+    def __len__(self):
+        return len(self._items)
+
+    def __getitem__(self, index):
+        if isinstance(index, slice):
+            return LazyListProxy(self._items[index])
+        return to_python_lazy(self._items[index])
+
+    def __repr__(self):
+        return f"LazyListProxy(<{len(self._items)} items>)"
+
+
+class LazyMapProxy(Mapping):
+    """Read-only Python mapping over TinyTalk map data (lazy values)."""
+
+    __slots__ = ('_pairs',)
+
+    def __init__(self, pairs: Dict[Any, Value]):
+        self._pairs = pairs
+
+    def __len__(self):
+        return len(self._pairs)
+
+    def __iter__(self):
+        return iter(self._pairs)
+
+    def __getitem__(self, key):
+        return to_python_lazy(self._pairs[key])
+
+    def __repr__(self):
+        return f"LazyMapProxy(<{len(self._pairs)} keys>)"
+
+
+def to_python_lazy(value: Value) -> Any:
+    """Convert a TinyTalk value to Python, wrapping containers in lazy
+    proxies instead of deep-converting them."""
+    if value.type == ValueType.NULL:
+        return None
+    if value.type == ValueType.LIST:
+        return LazyListProxy(value.data)
+    if value.type == ValueType.MAP:
+        return LazyMapProxy(value.data)
+    return value.data
+
+
 def from_python(obj: Any) -> Value:
     """Convert Python value to TinyTalk."""
     if obj is None:
         return Value.null_val()
+    # Proxies crossing back keep their underlying Values - no conversion
+    if isinstance(obj, LazyListProxy):
+        return Value.list_val(obj._items)
+    if isinstance(obj, LazyMapProxy):
+        return Value.map_val(obj._pairs)
     if isinstance(obj, bool):
         return Value.bool_val(obj)
     if isinstance(obj, int):
@@ -89,12 +158,22 @@ def from_python(obj: Any) -> Value:
     return Value.string_val(str(obj))
 
 
-def wrap_python_function(fn: Callable) -> Value:
-    """Wrap a Python function for TinyTalk."""
+def wrap_python_function(fn: Callable, eager: bool = True) -> Value:
+    """Wrap a Python function for TinyTalk.
+
+    Arguments cross the boundary eagerly converted by default: imported
+    callables (import_python / import_builtin route everything through
+    here) routinely need real lists and dicts - json.dumps on a lazy
+    proxy raises TypeError. Pass eager=False for helpers known to only
+    read a few fields of large containers; they receive
+    LazyListProxy/LazyMapProxy and pay O(reads) instead of O(n).
+    """
     from .runtime import TinyFunction
-    
+
+    convert = to_python if eager else to_python_lazy
+
     def wrapper(args: List[Value]) -> Value:
-        py_args = [to_python(a) for a in args]
+        py_args = [convert(a) for a in args]
         result = fn(*py_args)
         return from_python(result)
     
@@ -137,13 +137,26 @@ def builtin_card_get(args: List[Value]) -> Value:
 
 def builtin_card_all(args: List[Value]) -> Value:
     """
-    Get all Cards.
+    Get all Cards - or prefetch a specific set in one bulk read.
     
     Usage:
         let cards = Card.all()
+        let some = Card.all(["hash1", "hash2"])   // bulk prefetch, in order
     """
     store = get_object_store()
-    cards = store.get_by_type(ObjectType.CARD)
+    cards = store.get_by_type(ObjectType.CARD)  # single bulk read
+
+    if args and args[0].type == ValueType.LIST:
+        # Prefetch: select requested hashes from the bulk read instead of
+        # issuing one store.get round-trip per card
+        by_hash = {getattr(c, 'hash', None): c for c in cards}
+        out = []
+        for v in args[0].data:
+            wanted = v.data if hasattr(v, 'data') else str(v)
+            c = by_hash.get(wanted)
+            out.append(foghorn_to_tinytalk(c) if c is not None else Value.null_val())
+        return Value.list_val(out)
+
     return Value.list_val([foghorn_to_tinytalk(c) for c in cards])
 
 
@@ -200,37 +213,26 @@ def builtin_services_list(args: List[Value]) -> Value:
     ])
 
 
-def builtin_services_run(args: List[Value]) -> Value:
-    """
-    Run a service on an object.
-    
-    Usage:
-        let result = Services.run("Compute", query)
-        let result = Services.run("Verify Claim", card)
-    """
-    if len(args) < 2:
-        return Value.null_val()
-    
-    service_name = args[0].data if args[0].type == ValueType.STRING else str(args[0].data)
-    
-    # Get the object from the store by hash
-    if args[1].type == ValueType.MAP and "hash" in args[1].data:
-        hash_val = args[1].data["hash"]
+def _service_error(message: str) -> Value:
+    return Value.map_val({
+        "success": Value.bool_val(False),
+        "error": Value.string_val(message),
+    })
+
+
+def _resolve_service_object(value: Value, store):
+    """Resolve a TinyTalk card/query map to its store object, or an error Value."""
+    if value.type == ValueType.MAP and "hash" in value.data:
+        hash_val = value.data["hash"]
         obj_hash = hash_val.data if hasattr(hash_val, 'data') else str(hash_val)
-        store = get_object_store()
         obj = store.get(obj_hash)
-        
         if not obj:
-            return Value.map_val({
-                "success": Value.bool_val(False),
-                "error": Value.string_val(f"Object not found: {obj_hash}"),
-            })
-    else:
-        return Value.map_val({
-            "success": Value.bool_val(False),
-            "error": Value.string_val("Invalid object - must have 'hash' field"),
-        })
-    
+            return None, _service_error(f"Object not found: {obj_hash}")
+        return obj, None
+    return None, _service_error("Invalid object - must have 'hash' field")
+
+
+def _execute_service_to_value(service_name: str, obj) -> Value:
     try:
         result = execute_service(service_name, obj)
         return Value.map_val({
@@ -240,10 +242,72 @@ def builtin_services_run(args: List[Value]) -> Value:
             "error": Value.string_val(result.error) if result.error else Value.null_val(),
         })
     except Exception as e:
-        return Value.map_val({
-            "success": Value.bool_val(False),
-            "error": Value.string_val(str(e)),
-        })
+        return _service_error(str(e))
+
+
+def builtin_services_run(args: List[Value]) -> Value:
+    """
+    Run a service on an object.
+    
+    Usage:
+        let result = Services.run("Compute", query)
+        let result = Services.run("Verify Claim", card)
+    """
+    if len(args) < 2:
+        return Value.null_val()
+    
+    service_name = args[0].data if args[0].type == ValueType.STRING else str(args[0].data)
+    obj, error = _resolve_service_object(args[1], get_object_store())
+    if error is not None:
+        return error
+    return _execute_service_to_value(service_name, obj)
+
+
+def builtin_services_run_many(args: List[Value]) -> Value:
+    """
+    Run a batch of services with bounded concurrency.
+
+    Usage:
+        let results = Services.run_many([["Compute", q], ["Verify Claim", c]])
+        let results = Services.run_many(pairs, 8)    // concurrency limit
+
+    One store session resolves every object up front, invocations run
+    across a bounded thread pool, and results come back in input order -
+    so enriching N cards costs one round of overlapping round-trips
+    instead of N sequential ones.
+    """
+    from concurrent.futures import ThreadPoolExecutor
+
+    if not args or args[0].type != ValueType.LIST:
+        return Value.list_val([])
+    pairs = args[0].data
+    concurrency = 8
+    if len(args) > 1 and args[1].type == ValueType.INT:
+        concurrency = max(1, int(args[1].data))
+
+    store = get_object_store()  # one session for the whole batch
+    jobs = []  # (service_name, obj) or precomputed error Value
+    for pair in pairs:
+        if pair.type != ValueType.LIST or len(pair.data) < 2:
+            jobs.append(_service_error("Each batch item must be [service, object]"))
+            continue
+        name_val, obj_val = pair.data[0], pair.data[1]
+        service_name = name_val.data if name_val.type == ValueType.STRING else str(name_val.data)
+        obj, error = _resolve_service_object(obj_val, store)
+        jobs.append(error if error is not None else (service_name, obj))
+
+    if not any(isinstance(j, tuple) for j in jobs):
+        return Value.list_val(jobs)
+
+    def invoke(job):
+        if not isinstance(job, tuple):
+            return job  # resolution error, already shaped
+        return _execute_service_to_value(job[0], job[1])
+
+    workers = min(concurrency, max(1, sum(1 for j in jobs if isinstance(j, tuple))))
+    with ThreadPoolExecutor(max_workers=workers) as pool:
+        results = list(pool.map(invoke, jobs))  # preserves input order
+    return Value.list_val(results)
 
 
 def builtin_services_for(args: List[Value]) -> Value:
@@ -446,6 +510,7 @@ FOGHORN_BUILTINS = {
     # Services
     'Services.list': builtin_services_list,
     'Services.run': builtin_services_run,
+    'Services.run_many': builtin_services_run_many,
     'Services.find_for': builtin_services_for,  # Renamed from 'for' (reserved word)
     
     # Inspector
@@ -466,34 +531,42 @@ FOGHORN_BUILTINS = {
 }
 
 
+_FOGHORN_TABLE = None
+
+
+def _builtin_table():
+    """Process-wide table of wrapped builtins, built once and shared."""
+    global _FOGHORN_TABLE
+    if _FOGHORN_TABLE is None:
+        from realTinyTalk.runtime import TinyFunction
+
+        flat = {}
+        namespaces = {}
+        for name, fn in FOGHORN_BUILTINS.items():
+            func_val = Value(ValueType.FUNCTION, TinyFunction(
+                name=name, params=[], body=None, closure=None,
+                is_native=True, native_fn=fn))
+            if '.' in name:
+                obj_name, method_name = name.split('.', 1)
+                namespaces.setdefault(obj_name, {})[method_name] = func_val
+            else:
+                flat[name] = func_val
+        _FOGHORN_TABLE = (flat, namespaces)
+    return _FOGHORN_TABLE
+
+
 def register_foghorn_stdlib(runtime):
-    """Register Foghorn builtins with a TinyTalk runtime."""
-    from realTinyTalk.runtime import TinyFunction
-    
-    for name, fn in FOGHORN_BUILTINS.items():
-        # Create a native function wrapper
-        func = TinyFunction(
-            name=name,
-            params=[],
-            body=None,
-            closure=runtime.global_scope,
-            is_native=True,
-            native_fn=fn,
-        )
-        
-        # Handle dotted names (Card.new -> Card object with new method)
-        if '.' in name:
-            parts = name.split('.')
-            obj_name, method_name = parts[0], parts[1]
-            
-            # Get or create the namespace object
-            ns = runtime.global_scope.get(obj_name)
-            if ns is None or ns.type != ValueType.MAP:
-                ns = Value.map_val({})
-                runtime.global_scope.define(obj_name, ns)
-            
-            # Add method
-            ns.data[method_name] = Value(ValueType.FUNCTION, func)
+    """Register Foghorn builtins with a TinyTalk runtime.
+
+    Function values come from a shared per-process table; only the scope
+    entries and namespace maps are per-runtime (namespace maps are fresh
+    dicts so a script mutating e.g. Card cannot leak across runtimes).
+    """
+    flat, namespaces = _builtin_table()
+    runtime.global_scope.variables.update(flat)
+    for obj_name, methods in namespaces.items():
+        ns = runtime.global_scope.get(obj_name)
+        if ns is None or ns.type != ValueType.MAP:
+            runtime.global_scope.define(obj_name, Value.map_val(dict(methods)))
         else:
-            # Simple function
-            runtime.global_scope.define(name, Value(ValueType.FUNCTION, func))
+            ns.data.update(methods)
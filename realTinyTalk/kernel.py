@@ -8,8 +8,13 @@ Compile → Bound → Execute → Verify → Ledger → Return
 """
 
 from __future__ import annotations
+from collections import deque
 from dataclasses import dataclass, field
+from pathlib import Path
 from typing import Any, Dict, List, Optional, Callable, Union
+import mmap
+import os
+import struct
 import time
 import hashlib
 import json
@@ -64,6 +69,74 @@ class Trace:
         }
 
 
+# ═══════════════════════════════════════════════════════════════════════════════
+# TRACE POLICY - Bounded trace retention
+# ═══════════════════════════════════════════════════════════════════════════════
+
+@dataclass(frozen=True)
+class TracePolicy:
+    """
+    Retention policy for execution traces.
+
+    Batch jobs accumulate traces at O(ops); the policy bounds that:
+
+      full    - keep everything (the default, same as before)
+      ring    - keep only the newest ring_size entries
+      sample  - keep 1-in-sample_every ok traces; failures always kept
+      count   - keep nothing, count per-step; entries() yields one summary
+    """
+    mode: str = "full"
+    ring_size: int = 256
+    sample_every: int = 100
+
+
+class TraceLog:
+    """Trace accumulator honoring a TracePolicy.
+
+    Failed traces (ok=False) are always retained except in count mode -
+    bounded execution stays diagnosable even when the happy path is sampled
+    away.
+    """
+
+    def __init__(self, policy: Optional[TracePolicy] = None):
+        self.policy = policy or TracePolicy()
+        self.total = 0
+        self.dropped = 0
+        self.counts_by_step: Dict[str, int] = {}
+        if self.policy.mode == "ring":
+            self._entries = deque(maxlen=self.policy.ring_size)
+        else:
+            self._entries = []
+
+    def add(self, trace: 'Trace'):
+        """Record one trace according to the policy."""
+        self.total += 1
+        mode = self.policy.mode
+        if mode == "count":
+            step = trace.step
+            self.counts_by_step[step] = self.counts_by_step.get(step, 0) + 1
+            return
+        if mode == "sample" and trace.ok and (self.total % self.policy.sample_every):
+            self.dropped += 1
+            return
+        if mode == "ring" and len(self._entries) == self._entries.maxlen:
+            self.dropped += 1
+        self._entries.append(trace)
+
+    def extend(self, traces: List['Trace']):
+        for t in traces:
+            self.add(t)
+
+    def entries(self) -> List['Trace']:
+        """Retained traces; count mode yields a single summary entry."""
+        if self.policy.mode == "count":
+            return [Trace.t("trace:summary", True, {
+                "total": self.total,
+                "by_step": dict(self.counts_by_step),
+            })]
+        return list(self._entries)
+
+
 # ═══════════════════════════════════════════════════════════════════════════════
 # FIN / FINFR - Success and failure types
 # ═══════════════════════════════════════════════════════════════════════════════
@@ -144,6 +217,162 @@ class ExecutionBounds:
         return None
 
 
+class CanonicalHasher:
+    """Canonical binary hashing with identity memoization.
+
+    stable_json re-serializes every substructure on every append; here each
+    container's digest is computed bottom-up over a compact tagged binary
+    encoding (CBOR-like: type tag + payload, map keys sorted) and cached by
+    object identity, so re-hashing a large structure that shares unchanged
+    substructures with earlier appends costs O(changed).
+
+    The memo stores (obj, digest) pairs - holding a strong reference to the
+    cached object and verifying `entry is obj` on lookup - because a bare
+    id() key goes stale the moment the object is freed and its id reused by
+    a different container, which silently returns a wrong digest. The
+    remaining caveat is in-place mutation: re-hashing the same object after
+    mutating it returns the pre-mutation digest, so ledger inputs are
+    treated as immutable once appended.
+    """
+
+    _MEMO_LIMIT = 4096
+
+    def __init__(self):
+        # id(obj) -> (obj, digest); the strong obj reference pins the id
+        self._memo: Dict[int, tuple] = {}
+
+    def hash(self, obj: Any) -> str:
+        return self._digest(obj).hex()
+
+    def _digest(self, obj: Any) -> bytes:
+        if obj is None:
+            return hashlib.sha256(b'N').digest()
+        if obj is True:
+            return hashlib.sha256(b'T').digest()
+        if obj is False:
+            return hashlib.sha256(b'F').digest()
+        if isinstance(obj, int):
+            return hashlib.sha256(b'I' + str(obj).encode()).digest()
+        if isinstance(obj, float):
+            return hashlib.sha256(b'G' + repr(obj).encode()).digest()
+        if isinstance(obj, str):
+            return hashlib.sha256(b'S' + obj.encode('utf-8')).digest()
+        if isinstance(obj, list):
+            entry = self._memo.get(id(obj))
+            if entry is not None and entry[0] is obj:
+                return entry[1]
+            h = hashlib.sha256(b'L')
+            for item in obj:
+                h.update(self._digest(item))
+            digest = h.digest()
+            self._remember(obj, digest)
+            return digest
+        if isinstance(obj, dict):
+            entry = self._memo.get(id(obj))
+            if entry is not None and entry[0] is obj:
+                return entry[1]
+            h = hashlib.sha256(b'D')
+            for k in sorted(obj.keys(), key=str):
+                h.update(self._digest(str(k)))
+                h.update(self._digest(obj[k]))
+            digest = h.digest()
+            self._remember(obj, digest)
+            return digest
+        return hashlib.sha256(b'R' + repr(obj).encode()).digest()
+
+    def _remember(self, obj: Any, digest: bytes):
+        if len(self._memo) >= self._MEMO_LIMIT:
+            self._memo.clear()
+        self._memo[id(obj)] = (obj, digest)
+
+
+class Deadline:
+    """Amortized wall-clock enforcement for ExecutionBounds.
+
+    Calling time.time() on every operation measurably slows tight loops, so
+    the deadline is only consulted every `stride` operations, and the stride
+    adapts to recent op cost so checks land roughly target_interval seconds
+    apart (bounded 16..65536 ops). tick() returns True once expired.
+    """
+
+    __slots__ = ('timeout_seconds', 'expires_at', 'target', 'stride',
+                 'countdown', 'last_check')
+
+    MIN_STRIDE = 16
+    MAX_STRIDE = 65536
+
+    def __init__(self, timeout_seconds: float, target_interval: float = 0.005):
+        now = time.time()
+        self.timeout_seconds = timeout_seconds
+        self.expires_at = now + timeout_seconds
+        self.target = target_interval
+        self.stride = 64
+        self.countdown = 64
+        self.last_check = now
+
+    def tick(self) -> bool:
+        """Count one operation; True when the deadline has passed."""
+        self.countdown -= 1
+        if self.countdown > 0:
+            return False
+        now = time.time()
+        window = now - self.last_check
+        self.last_check = now
+        if window < self.target / 2 and self.stride < self.MAX_STRIDE:
+            self.stride *= 2
+        elif window > self.target * 2 and self.stride > self.MIN_STRIDE:
+            self.stride //= 2
+        self.countdown = self.stride
+        return now > self.expires_at
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# BUDGET REGISTRY - Named per-tenant execution budgets
+# ═══════════════════════════════════════════════════════════════════════════════
+
+class BudgetRegistry:
+    """Named ExecutionBounds profiles with a tenant -> profile mapping.
+
+    Lets the web server give paying tenants bigger bounds without touching
+    request-handler code. File format (JSON):
+
+        {
+          "profiles": {"free": {"max_ops": 1000000, "timeout_seconds": 10},
+                       "pro":  {"max_ops": 50000000, "timeout_seconds": 60}},
+          "tenants":  {"alice": "pro"},
+          "default":  "free"
+        }
+
+    Profile fields fall back to ExecutionBounds defaults when omitted.
+    """
+
+    def __init__(self, profiles: Optional[Dict[str, ExecutionBounds]] = None,
+                 tenants: Optional[Dict[str, str]] = None,
+                 default: str = "default"):
+        self.profiles = dict(profiles or {})
+        self.tenants = dict(tenants or {})
+        self.default = default
+        if default not in self.profiles:
+            self.profiles[default] = ExecutionBounds()
+
+    @classmethod
+    def from_file(cls, path: str) -> 'BudgetRegistry':
+        with open(path, 'r', encoding='utf-8') as f:
+            raw = json.load(f)
+        profiles = {
+            name: ExecutionBounds(**fields)
+            for name, fields in raw.get('profiles', {}).items()
+        }
+        return cls(profiles=profiles,
+                   tenants=raw.get('tenants', {}),
+                   default=raw.get('default', 'default'))
+
+    def bounds_for(self, tenant: str) -> ExecutionBounds:
+        """The bounds for a tenant, via its profile or the default."""
+        profile = self.tenants.get(tenant, self.default)
+        return self.profiles.get(profile) or self.profiles[self.default]
+
+
 # ═══════════════════════════════════════════════════════════════════════════════
 # LEDGER - Hash-chained audit trail
 # ═══════════════════════════════════════════════════════════════════════════════
@@ -160,24 +389,224 @@ class LedgerEntry:
     hash: str
 
 
+_SEGMENT_HEADER = struct.Struct('<4sBIQ32s')   # magic, ver, capacity, base_index, base_prev
+_SEGMENT_RECORD = struct.Struct('<Qd32s32s32s32s32s')  # index, ts, op, in, out, prev, hash
+_SEGMENT_MAGIC = b'TTLG'
+_SEGMENT_VERSION = 1
+_GENESIS_BYTES = b'\x00' * 32
+
+
+def _hash_to_bytes(h: str) -> bytes:
+    return _GENESIS_BYTES if h == 'GENESIS' else bytes.fromhex(h)
+
+
+def _hash_from_bytes(b: bytes) -> str:
+    return 'GENESIS' if b == _GENESIS_BYTES else b.hex()
+
+
+class LedgerSegmentStore:
+    """Durable append-only ledger segments.
+
+    Entries append as fixed-size binary records to a capacity-bounded
+    segment file through a buffered handle; a full segment is sealed
+    (flushed + fsynced) and the next one opens with the chain head as its
+    base checkpoint. Restarts resume the chain from the newest record
+    instead of restarting it, fast verification re-hashes only the active
+    segment (sealed segments are covered by their checkpoints), and audit
+    reads go through mmap so history never has to sit in RAM.
+    """
+
+    def __init__(self, directory, segment_capacity: int = 4096):
+        self.directory = Path(directory)
+        self.directory.mkdir(parents=True, exist_ok=True)
+        self.segment_capacity = segment_capacity
+        self._handle = None
+        self._active_count = 0
+        existing = sorted(self.directory.glob('segment-*.ttlg'))
+        self._segment_numbers = [int(p.stem.split('-')[1]) for p in existing]
+
+    def _segment_path(self, number: int) -> Path:
+        return self.directory / f"segment-{number:08d}.ttlg"
+
+    def _open_segment(self, number: int, base_index: int, base_prev: str):
+        path = self._segment_path(number)
+        self._handle = open(path, 'ab')
+        if self._handle.tell() == 0:
+            self._handle.write(_SEGMENT_HEADER.pack(
+                _SEGMENT_MAGIC, _SEGMENT_VERSION, self.segment_capacity,
+                base_index, _hash_to_bytes(base_prev)))
+        self._active_count = (self._handle.tell() - _SEGMENT_HEADER.size) \
+            // _SEGMENT_RECORD.size
+        if number not in self._segment_numbers:
+            self._segment_numbers.append(number)
+
+    def resume(self):
+        """(head_hash, total_entries) from disk; opens the active segment."""
+        if not self._segment_numbers:
+            self._open_segment(0, 0, 'GENESIS')
+            return 'GENESIS', 0
+        last = self._segment_numbers[-1]
+        head = 'GENESIS'
+        total = 0
+        with open(self._segment_path(last), 'rb') as f:
+            data = f.read()
+        count = (len(data) - _SEGMENT_HEADER.size) // _SEGMENT_RECORD.size
+        _, _, _, base_index, base_prev = _SEGMENT_HEADER.unpack_from(data, 0)
+        if count:
+            rec = _SEGMENT_RECORD.unpack_from(
+                data, _SEGMENT_HEADER.size + (count - 1) * _SEGMENT_RECORD.size)
+            head = _hash_from_bytes(rec[6])
+            total = rec[0] + 1
+        else:
+            head = _hash_from_bytes(base_prev)
+            total = base_index
+        if count >= self.segment_capacity:
+            self._open_segment(last + 1, total, head)
+        else:
+            self._open_segment(last, base_index, _hash_from_bytes(base_prev))
+        return head, total
+
+    def append(self, entry: 'LedgerEntry'):
+        """Append one entry; seals the segment at capacity."""
+        if self._handle is None:
+            self.resume()
+        self._handle.write(_SEGMENT_RECORD.pack(
+            entry.index, entry.timestamp,
+            entry.operation.encode('utf-8')[:32].ljust(32, b'\x00'),
+            _hash_to_bytes(entry.input_hash),
+            _hash_to_bytes(entry.output_hash),
+            _hash_to_bytes(entry.prev_hash),
+            _hash_to_bytes(entry.hash)))
+        self._active_count += 1
+        if self._active_count >= self.segment_capacity:
+            # Seal: durable flush, then open the next segment with this
+            # entry's hash as its base checkpoint
+            self._handle.flush()
+            os.fsync(self._handle.fileno())
+            self._handle.close()
+            number = self._segment_numbers[-1]
+            self._open_segment(number + 1, entry.index + 1, entry.hash)
+        else:
+            self._handle.flush()
+
+    def _iter_segment(self, number: int):
+        """Yield (index, prev_hash, hash) per record via mmap."""
+        path = self._segment_path(number)
+        with open(path, 'rb') as f:
+            size = os.fstat(f.fileno()).st_size
+            if size <= _SEGMENT_HEADER.size:
+                return  # header only, no records yet
+            with mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as mm:
+                count = (size - _SEGMENT_HEADER.size) // _SEGMENT_RECORD.size
+                for i in range(count):
+                    rec = _SEGMENT_RECORD.unpack_from(
+                        mm, _SEGMENT_HEADER.size + i * _SEGMENT_RECORD.size)
+                    yield rec[0], _hash_from_bytes(rec[5]), _hash_from_bytes(rec[6])
+
+    def _segment_base(self, number: int):
+        with open(self._segment_path(number), 'rb') as f:
+            _, _, _, base_index, base_prev = _SEGMENT_HEADER.unpack(
+                f.read(_SEGMENT_HEADER.size))
+        return base_index, _hash_from_bytes(base_prev)
+
+    def verify_active(self) -> bool:
+        """Fast check: only the unsealed segment's links (the sealed ones
+        are anchored by their base checkpoints)."""
+        if not self._segment_numbers:
+            return True
+        number = self._segment_numbers[-1]
+        _, prev = self._segment_base(number)
+        for _, rec_prev, rec_hash in self._iter_segment(number):
+            if rec_prev != prev:
+                return False
+            prev = rec_hash
+        return True
+
+    def verify_all(self) -> bool:
+        """Full audit: every segment's links plus cross-segment continuity,
+        streamed via mmap."""
+        prev = 'GENESIS'
+        for number in self._segment_numbers:
+            base_index, base_prev = self._segment_base(number)
+            if base_prev != prev:
+                return False
+            for _, rec_prev, rec_hash in self._iter_segment(number):
+                if rec_prev != prev:
+                    return False
+                prev = rec_hash
+        return True
+
+    def iter_entries(self):
+        """Stream (index, prev_hash, hash) across all segments (audit)."""
+        for number in self._segment_numbers:
+            yield from self._iter_segment(number)
+
+    def close(self):
+        if self._handle is not None:
+            self._handle.flush()
+            self._handle.close()
+            self._handle = None
+
+
 class Ledger:
-    """Hash-chained audit ledger."""
+    """Hash-chained audit ledger.
+
+    By default every entry stays in memory, as before. Long-running verified
+    jobs can pass max_entries to keep only a bounded ring of recent entries:
+    the hash chain is carried forward incrementally through head_hash, so
+    evicting old entries never weakens the chain guarantee. Evicted entries
+    can optionally be spilled to disk (JSON lines) via spill_path for audit.
+    """
 
-    def __init__(self) -> None:
+    def __init__(self, max_entries: Optional[int] = None,
+                 spill_path: Optional[str] = None,
+                 hash_version: int = 1,
+                 segment_dir: Optional[str] = None,
+                 segment_capacity: int = 4096) -> None:
         self.entries: List[LedgerEntry] = []
+        self.max_entries = max_entries
+        self.spill_path = spill_path
+        # Hashing semantics are declared per ledger version: v1 (the
+        # default) is the original stable_json + sha256; v2 opts into the
+        # canonical binary encoder with identity memoization (several
+        # times cheaper per append)
+        self.hash_version = hash_version
+        self._hasher = CanonicalHasher() if hash_version >= 2 else None
+        # Rolling chain state: hash of the newest entry, and the prev_hash
+        # the oldest *retained* entry must link to (hash of the last evicted
+        # entry, or GENESIS while nothing has been evicted)
+        self.head_hash = "GENESIS"
+        self.checkpoint_hash = "GENESIS"
+        self.total_appended = 0
+        self._spill_file = None  # Lazily opened append handle
+
+        # Durable segment store: resuming picks the chain up where the
+        # last process left it instead of restarting from GENESIS
+        self._segments = None
+        if segment_dir is not None:
+            self._segments = LedgerSegmentStore(segment_dir, segment_capacity)
+            head, total = self._segments.resume()
+            self.head_hash = head
+            self.checkpoint_hash = head
+            self.total_appended = total
+
+    def _hash_obj(self, obj: Any) -> str:
+        if self._hasher is not None:
+            return self._hasher.hash(obj)
+        return sha256(stable_json(obj))
 
     def append(self, op: str, input_obj: Any, output_obj: Any) -> LedgerEntry:
         """Add entry to ledger with hash chain."""
-        prev_hash = self.entries[-1].hash if self.entries else "GENESIS"
+        prev_hash = self.head_hash
         body = {
-            "i": len(self.entries),
+            "i": self.total_appended,
             "ts": time.time(),
             "op": op,
-            "in_hash": sha256(stable_json(input_obj)),
-            "out_hash": sha256(stable_json(output_obj)),
+            "in_hash": self._hash_obj(input_obj),
+            "out_hash": self._hash_obj(output_obj),
             "prev_hash": prev_hash,
         }
-        h = sha256(stable_json(body))
+        h = self._hash_obj(body)
         entry = LedgerEntry(
             index=body["i"],
             timestamp=body["ts"],
@@ -188,16 +617,71 @@ class Ledger:
             hash=h
         )
         self.entries.append(entry)
+        self.head_hash = h
+        self.total_appended += 1
+
+        if self._segments is not None:
+            self._segments.append(entry)
+
+        if self.max_entries is not None and len(self.entries) > self.max_entries:
+            overflow = len(self.entries) - self.max_entries
+            evicted = self.entries[:overflow]
+            del self.entries[:overflow]
+            self.checkpoint_hash = evicted[-1].hash
+            if self.spill_path:
+                if self._spill_file is None:
+                    # Kept open for the ledger's lifetime: eviction happens
+                    # on every append once the ring is full
+                    self._spill_file = open(self.spill_path, 'a', encoding='utf-8')
+                for e in evicted:
+                    self._spill_file.write(stable_json({
+                        "i": e.index,
+                        "ts": e.timestamp,
+                        "op": e.operation,
+                        "in_hash": e.input_hash,
+                        "out_hash": e.output_hash,
+                        "prev_hash": e.prev_hash,
+                        "hash": e.hash,
+                    }) + "\n")
+                self._spill_file.flush()
         return entry
 
     def verify_chain(self) -> bool:
-        """Verify the hash chain integrity."""
-        for i, entry in enumerate(self.entries):
-            expected_prev = self.entries[i-1].hash if i > 0 else "GENESIS"
-            if entry.prev_hash != expected_prev:
+        """Verify the hash chain over the retained entries.
+
+        The oldest retained entry must link to the eviction checkpoint
+        (GENESIS when nothing was evicted), and the newest must match the
+        rolling head - so the guarantee covers the full stream, not just
+        what is still in memory.
+        """
+        prev = self.checkpoint_hash
+        for entry in self.entries:
+            if entry.prev_hash != prev:
                 return False
+            prev = entry.hash
+        if prev != self.head_hash:
+            return False
+        if self._segments is not None and not self._segments.verify_active():
+            return False
         return True
 
+    def verify_spill(self) -> bool:
+        """Verify the spilled portion of the chain on disk, if any."""
+        if not self.spill_path:
+            return True
+        prev = "GENESIS"
+        try:
+            with open(self.spill_path, 'r', encoding='utf-8') as f:
+                for line in f:
+                    rec = json.loads(line)
+                    if rec["prev_hash"] != prev:
+                        return False
+                    prev = rec["hash"]
+        except FileNotFoundError:
+            return True
+        # Spilled tail must link up to the oldest retained entry
+        return prev == self.checkpoint_hash
+
     def __len__(self) -> int:
         return len(self.entries)
 
@@ -229,10 +713,23 @@ class Compiler:
         self.lexer_class = Lexer
         self.parser_class = Parser
 
-    def compile(self, source: str) -> Result:
-        """Compile source code to AST."""
+    def compile(self, source: str, snapshot_path: Optional[str] = None) -> Result:
+        """Compile source code to AST.
+
+        When snapshot_path names a binary AST snapshot (see snapshot.py)
+        matching this source's hash, the tree is deserialized instead of
+        parsed - stale or mismatched snapshots fall back to a normal parse,
+        and a fresh snapshot is written after parsing.
+        """
         trace = [Trace.t("compile:start", True, {"length": len(source)})]
 
+        if snapshot_path:
+            from . import snapshot
+            ast = snapshot.load_snapshot(snapshot_path, sha256(source))
+            if ast is not None:
+                trace.append(Trace.t("compile:snapshot", True, {"path": str(snapshot_path)}))
+                return fin(ast, trace)
+
         try:
             # Tokenize
             lexer = self.lexer_class(source)
@@ -244,6 +741,11 @@ class Compiler:
             ast = parser.parse()
             trace.append(Trace.t("compile:parse", True, {"nodes": len(ast) if isinstance(ast, list) else 1}))
 
+            if snapshot_path:
+                from . import snapshot
+                if snapshot.save_snapshot(snapshot_path, ast, sha256(source)):
+                    trace.append(Trace.t("compile:snapshot_write", True, {"path": str(snapshot_path)}))
+
             return fin(ast, trace)
 
         except SyntaxError as e:
@@ -311,16 +813,19 @@ class Executor:
 
     def __init__(self, bounds: ExecutionBounds):
         self.bounds = bounds
+        self._prototype = None  # built on first run, forked per execution
 
     def run(self, ast: Any, env: Dict[str, Any]) -> tuple[Any, List[Trace]]:
         """Execute AST within bounds."""
-        from .runtime import Runtime
-        
+        from .runtime import RuntimePrototype
+
         trace = [Trace.t("exec:start", True)]
         start_time = time.time()
 
         try:
-            runtime = Runtime(self.bounds)
+            if self._prototype is None:
+                self._prototype = RuntimePrototype(self.bounds)
+            runtime = self._prototype.fork()
             # Seed global scope with env bindings
             if env:
                 for k, v in env.items():
@@ -376,11 +881,13 @@ class TinyTalkKernel:
         self,
         bounds: Optional[ExecutionBounds] = None,
         policy: Optional[TrustPolicy] = None,
-        env: Optional[Dict[str, Any]] = None
+        env: Optional[Dict[str, Any]] = None,
+        trace_policy: Optional[TracePolicy] = None
     ):
         self.bounds = bounds or ExecutionBounds()
         self.policy = policy or TrustPolicy()
         self.env = env or {}
+        self.trace_policy = trace_policy or TracePolicy()
         
         self.compiler = Compiler()
         self.verifier = Verifier(self.policy)
@@ -390,48 +897,49 @@ class TinyTalkKernel:
 
     def run(self, source: str) -> Result:
         """Execute TinyTalk source code."""
-        trace: List[Trace] = [Trace.t("kernel:start", True)]
+        log = TraceLog(self.trace_policy)
+        log.add(Trace.t("kernel:start", True))
 
         # 1) Compile
         compile_result = self.compiler.compile(source)
-        trace.extend(compile_result.trace)
+        log.extend(compile_result.trace)
         if isinstance(compile_result, Finfr):
             self.ledger.append("finfr", {"source": source[:100]}, {"reason": compile_result.reason})
-            return finfr(compile_result.reason, trace)
+            return finfr(compile_result.reason, log.entries())
 
         ast = compile_result.value
 
         # 2) Pre-verify
         pre = self.verifier.precheck(ast)
-        trace.extend(pre.trace)
+        log.extend(pre.trace)
         if isinstance(pre, Finfr):
             self.ledger.append("finfr", {"source": source[:100]}, {"reason": pre.reason})
-            return finfr(pre.reason, trace)
+            return finfr(pre.reason, log.entries())
 
         # 3) Execute (bounded)
         try:
             result, exec_trace = self.executor.run(ast, self.env)
-            trace.extend(exec_trace)
+            log.extend(exec_trace)
         except RuntimeError as e:
             self.ledger.append("finfr", {"source": source[:100]}, {"reason": str(e)})
-            return finfr(str(e), trace)
+            return finfr(str(e), log.entries())
 
         # 4) Post-verify
-        post = self.verifier.postcheck(result, trace)
-        trace.extend(post.trace)
+        post = self.verifier.postcheck(result, log.entries())
+        log.extend(post.trace)
         if isinstance(post, Finfr):
             self.ledger.append("unverified", {"source": source[:100]}, {"result": str(result)})
-            return finfr(post.reason, trace)
+            return finfr(post.reason, log.entries())
 
         # 5) Ledger commit
         entry = self.ledger.append("fin", {"source": source[:100]}, {"result": str(result)})
-        trace.append(Trace.t("ledger:commit", True, {"hash": entry.hash}))
+        log.add(Trace.t("ledger:commit", True, {"hash": entry.hash}))
 
         # 6) Meta verify
         m = self.meta.verify(self.ledger)
-        trace.extend(m.trace)
+        log.extend(m.trace)
 
-        return fin(result, trace)
+        return fin(result, log.entries())
 
     def eval(self, source: str) -> Any:
         """Convenience method - execute and return just the value."""
@@ -8,9 +8,8 @@ Keywords frozen to prevent semantic drift.
 ═══════════════════════════════════════════════════════════════════════════════
 """
 
-from dataclasses import dataclass
 from enum import Enum, auto
-from typing import List, Optional, Any
+from typing import List, Any
 import re
 
 
@@ -200,14 +199,20 @@ class TokenType(Enum):
     COMMENT = auto()
 
 
-@dataclass
 class Token:
-    """A token in the source code."""
-    type: TokenType
-    value: Any
-    line: int
-    column: int
-    
+    """A token in the source code.
+
+    Compact __slots__ layout: 10k-line generated scripts materialize one of
+    these per token, so no per-instance dict.
+    """
+    __slots__ = ('type', 'value', 'line', 'column')
+
+    def __init__(self, type: TokenType, value: Any, line: int, column: int):
+        self.type = type
+        self.value = value
+        self.line = line
+        self.column = column
+
     def __repr__(self) -> str:
         if self.type in (TokenType.NEWLINE, TokenType.EOF):
             return f"Token({self.type.name})"
@@ -377,6 +382,27 @@ class Lexer:
         '#': TokenType.HASH,
         '$': TokenType.DOLLAR,
     }
+
+    # Combined operator dispatch table for the master scanner
+    OP_TYPES = {**dict(OPERATORS), **SINGLE_OPS}
+
+    # Master scanner pattern - alternation order encodes precedence:
+    # comments outrank operators ('//' and '#' are always comments),
+    # multi-char operators outrank numbers ('..' before '.5'), and numbers
+    # outrank the single-char '.' so '.5' lexes as a float.
+    MASTER_RE = re.compile(
+        r'(?P<ws>[ \t\r]+)'
+        r'|(?P<nl>\n)'
+        r'|(?P<mlc>/\*(?:.*?\*/|.*\Z))'
+        r'|(?P<cmt>//[^\n]*|\#[^\n]*)'
+        r'|(?P<mop>' + '|'.join(re.escape(op) for op, _ in OPERATORS) + r')'
+        r'|(?P<num>0[xX][0-9a-fA-F_]+|0[oO][0-7_]+|0[bB][01_]+'
+        r'|\d[\d_]*(?:\.\d[\d_]*)?(?:[eE][+-]?\d+)?'
+        r'|\.\d[\d_]*(?:[eE][+-]?\d+)?)'
+        r'|(?P<ident>[^\W\d]\w*)'
+        r'|(?P<sop>[' + re.escape(''.join(SINGLE_OPS)) + r'])',
+        re.DOTALL
+    )
     
     def __init__(self, source: str):
         self.source = source
@@ -384,18 +410,117 @@ class Lexer:
         self.line = 1
         self.column = 1
         self.tokens: List[Token] = []
-    
+
     def tokenize(self) -> List[Token]:
-        """Tokenize the entire source."""
-        while not self._at_end():
-            self._skip_whitespace()
-            if self._at_end():
-                break
-            self._scan_token()
-        
-        self.tokens.append(Token(TokenType.EOF, None, self.line, self.column))
+        """Tokenize the entire source.
+
+        Driven by one master pattern (MASTER_RE below) instead of a
+        char-by-char loop - one regex match per token. String literals
+        delegate to _scan_string, which owns escapes, raw mode, and triple
+        quotes. The emitted token stream is unchanged.
+        """
+        src = self.source
+        n = len(src)
+        tokens = self.tokens
+        match = self.MASTER_RE.match
+        pos = 0
+        line = 1
+        col = 1
+
+        while pos < n:
+            c = src[pos]
+
+            # String literals (and raw strings via the identifier group
+            # below) keep the dedicated scanner
+            if c == '"' or c == "'":
+                self.pos, self.line, self.column = pos, line, col
+                self._scan_string(c)
+                pos, line, col = self.pos, self.line, self.column
+                continue
+
+            m = match(src, pos)
+            if m is None:
+                # Unknown character
+                tokens.append(Token(TokenType.ERROR, c, line, col))
+                pos += 1
+                col += 1
+                continue
+
+            kind = m.lastgroup
+            text = m.group()
+            end = m.end()
+
+            if kind == 'ws':
+                col += end - pos
+                pos = end
+
+            elif kind == 'nl':
+                # Track newlines for statement separation
+                tokens.append(Token(TokenType.NEWLINE, '\n', line, 1))
+                line += 1
+                col = 1
+                pos = end
+
+            elif kind == 'cmt':
+                col += end - pos
+                pos = end
+
+            elif kind == 'mlc':
+                newlines = text.count('\n')
+                if newlines:
+                    line += newlines
+                    col = len(text) - text.rfind('\n')
+                else:
+                    col += end - pos
+                pos = end
+
+            elif kind == 'num':
+                if text[:2] in ('0x', '0X'):
+                    value = int(text.replace('_', ''), 16)
+                elif text[:2] in ('0o', '0O'):
+                    value = int(text.replace('_', ''), 8)
+                elif text[:2] in ('0b', '0B'):
+                    value = int(text.replace('_', ''), 2)
+                elif '.' in text or 'e' in text or 'E' in text:
+                    value = float(text.replace('_', ''))
+                else:
+                    value = int(text.replace('_', ''))
+                tokens.append(Token(TokenType.NUMBER, value, line, col))
+                col += end - pos
+                pos = end
+
+            elif kind == 'ident':
+                # Raw strings: r"..." / r'...'
+                if text == 'r' and end < n and src[end] in '"\'':
+                    self.pos, self.line, self.column = end, line, col + 1
+                    self._scan_string(src[end], raw=True)
+                    pos, line, col = self.pos, self.line, self.column
+                    continue
+                if text in self.STEP_KEYWORDS:
+                    tokens.append(Token(self.STEP_KEYWORDS[text], text, line, col))
+                elif text in self.KEYWORDS:
+                    token_type = self.KEYWORDS[text]
+                    if token_type == TokenType.BOOLEAN:
+                        value = text == 'true'
+                    elif token_type == TokenType.NULL:
+                        value = None
+                    else:
+                        value = text
+                    tokens.append(Token(token_type, value, line, col))
+                else:
+                    tokens.append(Token(TokenType.IDENTIFIER, text, line, col))
+                col += end - pos
+                pos = end
+
+            else:  # 'mop' / 'sop' - operators
+                tokens.append(Token(self.OP_TYPES[text], text, line, col))
+                col += end - pos
+                pos = end
+
+        self.pos, self.line, self.column = pos, line, col
+        self.tokens.append(Token(TokenType.EOF, None, line, col))
         return self.tokens
-    
+
     def _at_end(self) -> bool:
         return self.pos >= len(self.source)
     
@@ -415,90 +540,6 @@ class Lexer:
             self.column += 1
         return c
     
-    def _match(self, expected: str) -> bool:
-        if self._at_end() or self.source[self.pos] != expected:
-            return False
-        self._advance()
-        return True
-    
-    def _skip_whitespace(self):
-        """Skip whitespace and comments."""
-        while not self._at_end():
-            c = self._peek()
-            
-            if c in ' \t\r':
-                self._advance()
-            elif c == '\n':
-                # Track newlines for statement separation
-                self._advance()
-                self.tokens.append(Token(TokenType.NEWLINE, '\n', self.line - 1, self.column))
-            elif c == '/' and self._peek(1) == '/':
-                # Single-line comment
-                while not self._at_end() and self._peek() != '\n':
-                    self._advance()
-            elif c == '/' and self._peek(1) == '*':
-                # Multi-line comment
-                self._advance()  # /
-                self._advance()  # *
-                while not self._at_end():
-                    if self._peek() == '*' and self._peek(1) == '/':
-                        self._advance()  # *
-                        self._advance()  # /
-                        break
-                    self._advance()
-            elif c == '#':
-                # Hash comment (Python/Ruby style)
-                while not self._at_end() and self._peek() != '\n':
-                    self._advance()
-            else:
-                break
-    
-    def _scan_token(self):
-        """Scan a single token."""
-        start_line = self.line
-        start_col = self.column
-        
-        # Check multi-char operators first
-        for op, token_type in self.OPERATORS:
-            if self.source[self.pos:self.pos + len(op)] == op:
-                for _ in range(len(op)):
-                    self._advance()
-                self.tokens.append(Token(token_type, op, start_line, start_col))
-                return
-        
-        c = self._peek()
-        
-        # String literals
-        if c in '"\'':
-            self._scan_string(c)
-            return
-        
-        # Raw strings
-        if c == 'r' and self._peek(1) in '"\'':
-            self._advance()  # r
-            self._scan_string(self._peek(), raw=True)
-            return
-        
-        # Numbers
-        if c.isdigit() or (c == '.' and self._peek(1).isdigit()):
-            self._scan_number()
-            return
-        
-        # Identifiers and keywords
-        if c.isalpha() or c == '_':
-            self._scan_identifier()
-            return
-        
-        # Single-char operators
-        if c in self.SINGLE_OPS:
-            self._advance()
-            self.tokens.append(Token(self.SINGLE_OPS[c], c, start_line, start_col))
-            return
-        
-        # Unknown character
-        self._advance()
-        self.tokens.append(Token(TokenType.ERROR, c, start_line, start_col))
-    
     def _scan_string(self, quote: str, raw: bool = False):
         """Scan a string literal."""
         start_line = self.line
@@ -544,63 +585,6 @@ class Lexer:
         
         self.tokens.append(Token(TokenType.STRING, ''.join(value), start_line, start_col))
     
-    def _scan_number(self):
-        """Scan a number literal."""
-        start_line = self.line
-        start_col = self.column
-        start_pos = self.pos
-        
-        # Check for hex, octal, binary
-        if self._peek() == '0':
-            self._advance()
-            if self._peek() in 'xX':
-                self._advance()
-                while self._peek() in '0123456789abcdefABCDEF_':
-                    self._advance()
-                value = int(self.source[start_pos:self.pos].replace('_', ''), 16)
-                self.tokens.append(Token(TokenType.NUMBER, value, start_line, start_col))
-                return
-            elif self._peek() in 'oO':
-                self._advance()
-                while self._peek() in '01234567_':
-                    self._advance()
-                value = int(self.source[start_pos:self.pos].replace('_', ''), 8)
-                self.tokens.append(Token(TokenType.NUMBER, value, start_line, start_col))
-                return
-            elif self._peek() in 'bB':
-                self._advance()
-                while self._peek() in '01_':
-                    self._advance()
-                value = int(self.source[start_pos:self.pos].replace('_', ''), 2)
-                self.tokens.append(Token(TokenType.NUMBER, value, start_line, start_col))
-                return
-        
-        # Regular decimal number
-        while self._peek().isdigit() or self._peek() == '_':
-            self._advance()
-        
-        # Decimal part
-        is_float = False
-        if self._peek() == '.' and self._peek(1).isdigit():
-            is_float = True
-            self._advance()  # .
-            while self._peek().isdigit() or self._peek() == '_':
-                self._advance()
-        
-        # Exponent
-        if self._peek() in 'eE':
-            is_float = True
-            self._advance()
-            if self._peek() in '+-':
-                self._advance()
-            while self._peek().isdigit():
-                self._advance()
-        
-        num_str = self.source[start_pos:self.pos].replace('_', '')
-        value = float(num_str) if is_float else int(num_str)
-        
-        self.tokens.append(Token(TokenType.NUMBER, value, start_line, start_col))
-    
     # Step keywords - _underscore prefixed operations (dplyr-style)
     STEP_KEYWORDS = {
         '_filter': TokenType.STEP_FILTER,
@@ -622,32 +606,3 @@ class Lexer:
         '_zip': TokenType.STEP_ZIP,
         '_chunk': TokenType.STEP_CHUNK,
     }
-    
-    def _scan_identifier(self):
-        """Scan an identifier, keyword, or step."""
-        start_line = self.line
-        start_col = self.column
-        start_pos = self.pos
-        
-        while self._peek().isalnum() or self._peek() == '_':
-            self._advance()
-        
-        text = self.source[start_pos:self.pos]
-        
-        # Check for step keywords (_filter, _sort, etc.)
-        if text in self.STEP_KEYWORDS:
-            self.tokens.append(Token(self.STEP_KEYWORDS[text], text, start_line, start_col))
-            return
-        
-        # Check if keyword
-        if text in self.KEYWORDS:
-            token_type = self.KEYWORDS[text]
-            if token_type == TokenType.BOOLEAN:
-                value = text == 'true'
-            elif token_type == TokenType.NULL:
-                value = None
-            else:
-                value = text
-            self.tokens.append(Token(token_type, value, start_line, start_col))
-        else:
-            self.tokens.append(Token(TokenType.IDENTIFIER, text, start_line, start_col))
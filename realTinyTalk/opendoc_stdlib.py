@@ -62,6 +62,133 @@ from foghorn.cyberdog import (
 # In-memory storage for objects created in this session
 _session_docs: Dict[str, CompoundDocument] = {}
 _session_parts: Dict[str, Part] = {}
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# INCREMENTAL MERKLE VERIFICATION
+# ═══════════════════════════════════════════════════════════════════════════════
+# verify_all() rehashes every part on every call; for 5k-part documents each
+# save+verify cycle is seconds. Each session document instead maintains a
+# Merkle tree over its part hashes: Document.add updates only the affected
+# root path (O(log n)), edits mark dirty subtrees, and Document.verify
+# confirms the root by recomputing only dirty paths.
+
+import hashlib as _hashlib
+
+
+def _merkle_pair(left: str, right: str) -> str:
+    return _hashlib.sha256((left + right).encode('utf-8')).hexdigest()
+
+
+def _part_content_hash(part) -> str:
+    """Content hash recomputed from a part's actual current state.
+
+    Verification must rehash real content - a recorded hash only proves
+    what the part looked like when it was recorded.
+    """
+    from realTinyTalk.kernel import sha256, stable_json
+    if hasattr(part, 'to_dict'):
+        try:
+            return sha256(stable_json(part.to_dict()))
+        except Exception:
+            pass
+    return sha256(repr(part))
+
+
+class DocumentMerkle:
+    """Merkle tree over a document's part content hashes, with dirty
+    tracking.
+
+    Leaves are content hashes captured at embed time (the trusted values),
+    in embed order, alongside references to the parts themselves so verify
+    can rehash actual content. levels[0] is the leaf row; levels[-1] the
+    root row. Only paths touched since the last root() recompute - counted
+    in last_recomputed for observability.
+    """
+
+    def __init__(self):
+        self.leaves: List[str] = []
+        self.part_refs: List = []
+        self.leaf_index: Dict[str, int] = {}  # part id -> leaf position
+        self.levels: List[List[str]] = [[]]
+        self.dirty: set = set()
+        self.last_recomputed = 0
+
+    def add_part(self, part_id: str, part, content_hash: str):
+        """Record a part: new parts append a leaf, re-embedding an already
+        tracked part updates its leaf in place (dirty-subtree tracking)."""
+        existing = self.leaf_index.get(part_id)
+        if existing is not None:
+            self.part_refs[existing] = part
+            self.update_leaf(existing, content_hash)
+            return
+        self.leaves.append(content_hash)
+        self.part_refs.append(part)
+        self.leaf_index[part_id] = len(self.leaves) - 1
+        self.levels[0].append(content_hash)
+        self.dirty.add(len(self.leaves) - 1)
+
+    def update_leaf(self, index: int, part_hash: str):
+        if 0 <= index < len(self.leaves):
+            self.leaves[index] = part_hash
+            self.levels[0][index] = part_hash
+            self.dirty.add(index)
+
+    def root(self) -> str:
+        """Current root, recomputing only dirty paths (O(dirty * log n))."""
+        recomputed = 0
+        if not self.leaves:
+            self.last_recomputed = 0
+            return _hashlib.sha256(b'empty').hexdigest()
+
+        # Grow/shrink upper levels to match the leaf count
+        level_size = len(self.leaves)
+        depth = 1
+        while level_size > 1:
+            level_size = (level_size + 1) // 2
+            if depth >= len(self.levels):
+                self.levels.append([None] * level_size)
+            elif len(self.levels[depth]) != level_size:
+                old_level = self.levels[depth]
+                self.levels[depth] = (old_level[:level_size]
+                                      + [None] * (level_size - len(old_level)))
+            depth += 1
+        del self.levels[depth:]
+
+        dirty = set(self.dirty)
+        for level in range(1, len(self.levels)):
+            next_dirty = set()
+            row = self.levels[level]
+            below = self.levels[level - 1]
+            for i in {d // 2 for d in dirty}:
+                left = below[2 * i]
+                right = below[2 * i + 1] if 2 * i + 1 < len(below) else left
+                combined = _merkle_pair(left, right)
+                if row[i] != combined:
+                    row[i] = combined
+                recomputed += 1
+                next_dirty.add(i)
+            # Fill any never-computed slots (first build)
+            for i, v in enumerate(row):
+                if v is None:
+                    left = below[2 * i]
+                    right = below[2 * i + 1] if 2 * i + 1 < len(below) else left
+                    row[i] = _merkle_pair(left, right)
+                    recomputed += 1
+            dirty = next_dirty
+        self.dirty.clear()
+        self.last_recomputed = recomputed
+        return self.levels[-1][0]
+
+
+_session_merkle: Dict[str, DocumentMerkle] = {}
+
+
+def _merkle_for(doc_hash: str) -> DocumentMerkle:
+    tree = _session_merkle.get(doc_hash)
+    if tree is None:
+        tree = DocumentMerkle()
+        _session_merkle[doc_hash] = tree
+    return tree
 _session_browsers: Dict[str, WebBrowserPart] = {}
 _session_emails: Dict[str, EmailClientPart] = {}
 _session_news: Dict[str, NewsReaderPart] = {}
@@ -83,7 +210,8 @@ def builtin_document_new(args: List[Value]) -> Value:
     
     doc = create_document(title)
     _session_docs[doc.hash] = doc
-    
+    _session_merkle[doc.hash] = DocumentMerkle()
+
     return foghorn_to_tinytalk(doc)
 
 
@@ -140,6 +268,18 @@ def builtin_document_add(args: List[Value]) -> Value:
         container = args[2].data
     
     new_hash = embed_part(doc, part, container)
+
+    # Incremental Merkle maintenance: only this leaf's root path recomputes
+    # (re-embedding an already tracked part updates its leaf in place)
+    tree = _merkle_for(doc_hash)
+    tree.add_part(part_hash, part, _part_content_hash(part))
+    if new_hash and new_hash != doc_hash:
+        # embed may rehash the document; keep the tree reachable under
+        # both the old and new document hash
+        _session_merkle[new_hash] = tree
+        if new_hash in _session_docs or doc_hash in _session_docs:
+            _session_docs.setdefault(new_hash, doc)
+
     return Value.string_val(new_hash)
 
 
@@ -158,6 +298,33 @@ def builtin_document_verify(args: List[Value]) -> Value:
         return Value.null_val()
     
     doc = _session_docs[doc_hash]
+
+    tree = _session_merkle.get(doc_hash)
+    if tree is not None and tree.leaves:
+        # Real verification: rehash each part's actual current content and
+        # compare it to the trusted leaf recorded at embed time; tampering
+        # with any part fails that part. The tree's job is the root: only
+        # dirty subtrees (new or re-embedded leaves) recompute.
+        part_results = []
+        all_ok = True
+        for part_id, index in tree.leaf_index.items():
+            current = _part_content_hash(tree.part_refs[index])
+            ok = current == tree.leaves[index]
+            all_ok = all_ok and ok
+            part_results.append(Value.map_val({
+                "part": Value.string_val(part_id),
+                "verified": Value.bool_val(ok),
+            }))
+        root = tree.root()
+        return Value.map_val({
+            "verified": Value.bool_val(all_ok),
+            "merkle_root": Value.string_val(root),
+            "parts": Value.list_val(part_results),
+            "recomputed_nodes": Value.int_val(tree.last_recomputed),
+        })
+
+    # Documents without a session tree (loaded from the store) still get
+    # the full rehash
     results = doc.verify_all()
     
     return foghorn_to_tinytalk(results)
@@ -988,35 +1155,42 @@ OPENDOC_CYBERDOG_BUILTINS = {
 }
 
 
+_OPENDOC_TABLE = None
+
+
+def _builtin_table():
+    """Process-wide table of wrapped builtins, built once and shared."""
+    global _OPENDOC_TABLE
+    if _OPENDOC_TABLE is None:
+        from realTinyTalk.runtime import TinyFunction
+
+        flat = {}
+        namespaces = {}
+        for name, fn in OPENDOC_CYBERDOG_BUILTINS.items():
+            func_val = Value(ValueType.FUNCTION, TinyFunction(
+                name=name, params=[], body=None, closure=None,
+                is_native=True, native_fn=fn))
+            if '.' in name:
+                obj_name, method_name = name.split('.', 1)
+                namespaces.setdefault(obj_name, {})[method_name] = func_val
+            else:
+                flat[name] = func_val
+        _OPENDOC_TABLE = (flat, namespaces)
+    return _OPENDOC_TABLE
+
+
 def register_opendoc_cyberdog_stdlib(runtime):
-    """Register OpenDoc/CyberDog builtins with a TinyTalk runtime."""
-    from realTinyTalk.runtime import TinyFunction
-    from realTinyTalk.types import ValueType
-    
-    for name, fn in OPENDOC_CYBERDOG_BUILTINS.items():
-        # Create a native function wrapper
-        func = TinyFunction(
-            name=name,
-            params=[],
-            body=None,
-            closure=runtime.global_scope,
-            is_native=True,
-            native_fn=fn,
-        )
-        
-        # Handle dotted names (Document.new -> Document object with new method)
-        if '.' in name:
-            parts = name.split('.')
-            obj_name, method_name = parts[0], parts[1]
-            
-            # Get or create the namespace object
-            ns = runtime.global_scope.get(obj_name)
-            if ns is None or ns.type != ValueType.MAP:
-                ns = Value.map_val({})
-                runtime.global_scope.define(obj_name, ns)
-            
-            # Add method
-            ns.data[method_name] = Value(ValueType.FUNCTION, func)
+    """Register OpenDoc/CyberDog builtins with a TinyTalk runtime.
+
+    Function values come from a shared per-process table; only the scope
+    entries and namespace maps are per-runtime (namespace maps are fresh
+    dicts so a script mutating e.g. Card cannot leak across runtimes).
+    """
+    flat, namespaces = _builtin_table()
+    runtime.global_scope.variables.update(flat)
+    for obj_name, methods in namespaces.items():
+        ns = runtime.global_scope.get(obj_name)
+        if ns is None or ns.type != ValueType.MAP:
+            runtime.global_scope.define(obj_name, Value.map_val(dict(methods)))
         else:
-            # Simple function
-            runtime.global_scope.define(name, Value(ValueType.FUNCTION, func))
+            ns.data.update(methods)
@@ -0,0 +1,55 @@
+"""
+═══════════════════════════════════════════════════════════════════════════════
+TINYTALK PROFILER
+Per-node-type and per-function counters with sampled timers
+
+Counts everything, times a sample - visibility without slowing the loop.
+═══════════════════════════════════════════════════════════════════════════════
+"""
+
+from typing import Dict
+
+
+class Profiler:
+    """Execution profile accumulator.
+
+    Node-type and call counts are exact (one dict increment each); wall
+    time is sampled 1-in-sample_every and scaled in the report, so the
+    timed path never dominates. Timings are inclusive (a node's sample
+    includes its children), which is what "where does the time go" needs.
+
+    Enabled via Runtime.enable_profiling(), which shadows the hot _eval
+    with the profiled variant on that instance only - a disabled runtime
+    executes exactly the unprofiled code.
+    """
+
+    __slots__ = ('sample_every', 'tick', 'node_counts', 'node_time',
+                 'call_counts', 'builtin_counts')
+
+    def __init__(self, sample_every: int = 16):
+        self.sample_every = sample_every
+        self.tick = 0
+        self.node_counts: Dict[str, int] = {}
+        self.node_time: Dict[str, float] = {}
+        self.call_counts: Dict[str, int] = {}
+        self.builtin_counts: Dict[str, int] = {}
+
+    def report(self, top: int = 15) -> dict:
+        """JSON-ready profile: counts exact, sampled times scaled up."""
+        scale = float(self.sample_every)
+
+        def ranked(counts, limit=top):
+            return dict(sorted(counts.items(), key=lambda kv: -kv[1])[:limit])
+
+        return {
+            'sample_every': self.sample_every,
+            'nodes_evaluated': sum(self.node_counts.values()),
+            'node_counts': ranked(self.node_counts),
+            'node_time_ms': {
+                k: round(v * scale * 1000, 3)
+                for k, v in sorted(self.node_time.items(),
+                                   key=lambda kv: -kv[1])[:top]
+            },
+            'function_calls': ranked(self.call_counts),
+            'builtin_calls': ranked(self.builtin_counts),
+        }
@@ -11,7 +11,7 @@ from dataclasses import dataclass, field
 from typing import Any, Dict, List, Optional, Callable, Tuple
 import time
 
-from .kernel import ExecutionBounds, Trace, Ledger, fin, finfr
+from .kernel import Deadline, ExecutionBounds, Trace, Ledger, fin, finfr
 from .types import Value, ValueType, TinyType
 from .parser import (
     Program, Literal, Identifier, BinaryOp, UnaryOp, Call, Index, Member,
@@ -52,7 +52,11 @@ class TinyTalkError(Exception):
 
 class Scope:
     """Variable scope with parent chain."""
-    
+
+    # Frozen scopes (shared by forked runtimes) refuse writes so
+    # assignment falls through to copy-on-write in the child scope
+    frozen = False
+
     def __init__(self, parent: Optional['Scope'] = None):
         self.parent = parent
         self.variables: Dict[str, Value] = {}
@@ -77,6 +81,8 @@ class Scope:
         if name in self.variables:
             if name in self.constants:
                 raise TinyTalkError(f"Cannot reassign constant '{name}'")
+            if self.frozen:
+                return False  # copy-on-write: caller defines in its scope
             self.variables[name] = value
             return True
         if self.parent:
@@ -105,6 +111,7 @@ class TinyFunction:
     closure: Scope
     is_native: bool = False
     native_fn: Optional[Callable] = None
+    code: Optional[Any] = None  # Compiled bytecode (vm.CodeObject), if any
 
 
 @dataclass
@@ -148,6 +155,84 @@ class EnumVariant:
 # RUNTIME
 # ═══════════════════════════════════════════════════════════════════════════════
 
+_BUILTIN_TABLE = None
+
+
+def _builtin_table():
+    """Process-wide frozen builtin table: name -> function Value."""
+    global _BUILTIN_TABLE
+    if _BUILTIN_TABLE is None:
+        _BUILTIN_TABLE = {
+            name: Value.function_val(TinyFunction(name, [], None, None, True, fn))
+            for name, fn in Runtime._builtin_map().items()
+        }
+    return _BUILTIN_TABLE
+
+
+class _FrozenScope(Scope):
+    """Immutable shared scope backing forked runtimes."""
+    frozen = True
+
+
+class RuntimePrototype:
+    """
+    Immutable runtime template for cheap per-request instantiation.
+
+    Build once (builtins plus any extra registrars, e.g.
+    register_foghorn_stdlib), then fork() per request: forks share the
+    frozen global scope copy-on-write - reads chain through it, writes land
+    in the fork's own scope - and only mutable state (counters, ledger,
+    user scope, struct/enum registries) is fresh.
+
+    Map-typed globals (the Card/Document/... namespaces that registrars
+    define) are the one kind of template value a script can mutate through
+    without an assignment, so they are lifted out of the frozen scope and
+    re-wrapped with a fresh dict per fork - mutating Card in one fork can
+    never be seen by another.
+    """
+
+    def __init__(self, bounds: Optional[ExecutionBounds] = None, registrars=()):
+        template = Runtime(bounds)
+        for register in registrars:
+            register(template)
+        # Split mutable namespace maps from the immutably shareable rest
+        self._namespace_maps: Dict[str, Dict] = {}
+        frozen_vars: Dict[str, Value] = {}
+        for name, value in template.global_scope.variables.items():
+            if value.type == ValueType.MAP:
+                self._namespace_maps[name] = value.data
+            else:
+                frozen_vars[name] = value
+        frozen = _FrozenScope()
+        frozen.variables = frozen_vars
+        frozen.constants = template.global_scope.constants
+        self._frozen_scope = frozen
+        self._structs = template.structs
+        self._enums = template.enums
+        self.bounds = template.bounds
+
+    def fork(self, bounds: Optional[ExecutionBounds] = None) -> 'Runtime':
+        """A fresh Runtime sharing this prototype's frozen globals."""
+        rt = Runtime.__new__(Runtime)
+        rt.bounds = bounds or self.bounds
+        rt.global_scope = Scope(self._frozen_scope)
+        # Fresh per-fork namespace maps (values shared, dicts copied)
+        for name, data in self._namespace_maps.items():
+            rt.global_scope.variables[name] = Value.map_val(dict(data))
+        rt.structs = dict(self._structs)
+        rt.enums = dict(self._enums)
+        rt.ledger = Ledger()
+        rt.traces = []
+        rt.op_count = 0
+        rt.iteration_count = 0
+        rt.recursion_depth = 0
+        rt.start_time = 0.0
+        rt._vm_instance = None
+        rt._deadline = Deadline(rt.bounds.timeout_seconds)
+        rt.profiler = None
+        return rt
+
+
 class Runtime:
     """
     TinyTalk runtime interpreter.
@@ -169,13 +254,62 @@ class Runtime:
         self.recursion_depth = 0
         self.start_time = 0.0
         
+        # Bytecode VM, created on first compiled-code execution
+        self._vm_instance = None
+        self._deadline = Deadline(self.bounds.timeout_seconds)
+        self.profiler = None  # set by enable_profiling()
+
         # Register builtins
         self._register_builtins()
-    
+
+    @property
+    def _vm(self):
+        """Shared VM instance for compiled code (lazy, one per Runtime)."""
+        if self._vm_instance is None:
+            from .vm import VM
+            self._vm_instance = VM(self)
+        return self._vm_instance
+
+    def enable_profiling(self, sample_every: int = 16):
+        """Turn on per-node/per-function profiling for this runtime.
+
+        Shadows _eval with the profiled variant on this instance only, so
+        runtimes without profiling execute exactly the unprofiled code.
+        """
+        from .profiler import Profiler
+        self.profiler = Profiler(sample_every)
+        self._eval = self._profiled_eval
+
+    def _profiled_eval(self, node, scope: Scope) -> Value:
+        p = self.profiler
+        name = node.__class__.__name__
+        p.node_counts[name] = p.node_counts.get(name, 0) + 1
+        p.tick += 1
+        if p.tick % p.sample_every:
+            return Runtime._eval(self, node, scope)
+        t0 = time.perf_counter()
+        try:
+            return Runtime._eval(self, node, scope)
+        finally:
+            p.node_time[name] = p.node_time.get(name, 0.0) \
+                + (time.perf_counter() - t0)
+
     def _register_builtins(self):
-        """Register built-in functions."""
+        """Register built-in functions.
+
+        The Value-wrapped native function table is built once per process
+        (_builtin_table) and shared copy-on-write by every Runtime: only
+        the scope dict entries are copied, never the function objects.
+        """
+        table = _builtin_table()
+        gs = self.global_scope
+        gs.variables.update(table)
+        gs.constants.update(table)
+
+    @staticmethod
+    def _builtin_map():
         from . import stdlib
-        
+
         builtins = {
             # show is the primary way to print - friendly, auto-converts
             'show': stdlib.builtin_show,
@@ -188,6 +322,7 @@ class Runtime:
             'float': stdlib.builtin_float,
             'bool': stdlib.builtin_bool,
             'list': stdlib.builtin_list,
+            'array': stdlib.builtin_array,
             'map': stdlib.builtin_map,
             'range': stdlib.builtin_range,
             'sum': stdlib.builtin_sum,
@@ -230,12 +365,7 @@ class Runtime:
             'show': stdlib.builtin_show,
         }
         
-        for name, fn in builtins.items():
-            self.global_scope.define(
-                name,
-                Value.function_val(TinyFunction(name, [], None, self.global_scope, True, fn)),
-                const=True
-            )
+        return builtins
     
     def execute(self, ast) -> Value:
         """Execute an AST and return result."""
@@ -243,6 +373,7 @@ class Runtime:
         self.iteration_count = 0
         self.recursion_depth = 0
         self.start_time = time.time()
+        self._deadline = Deadline(self.bounds.timeout_seconds)
         self.traces = []
         
         try:
@@ -254,16 +385,34 @@ class Runtime:
             return e.value
         except (BreakException, ContinueException):
             raise TinyTalkError("Break/continue outside of loop")
+
+    def execute_code(self, code) -> Value:
+        """Execute a compiled CodeObject (see vm.py) and return result."""
+        self.op_count = 0
+        self.iteration_count = 0
+        self.recursion_depth = 0
+        self.start_time = time.time()
+        self._deadline = Deadline(self.bounds.timeout_seconds)
+        self.traces = []
+
+        try:
+            result = self._vm.run(code, self.global_scope)
+            self.traces.append(Trace.t("execute", True, {"result": str(result)}))
+            return result
+        except ReturnException as e:
+            self.traces.append(Trace.t("return", True, {"value": str(e.value)}))
+            return e.value
+        except (BreakException, ContinueException):
+            raise TinyTalkError("Break/continue outside of loop")
     
     def _check_bounds(self):
-        """Check execution bounds."""
+        """Check execution bounds (wall clock amortized via Deadline)."""
         self.op_count += 1
-        
+
         if self.op_count > self.bounds.max_ops:
             raise TinyTalkError(f"Exceeded maximum operations ({self.bounds.max_ops})")
-        
-        elapsed = time.time() - self.start_time
-        if elapsed > self.bounds.timeout_seconds:
+
+        if self._deadline.tick():
             raise TinyTalkError(f"Exceeded timeout ({self.bounds.timeout_seconds}s)")
     
     def _eval(self, node, scope: Scope) -> Value:
@@ -550,7 +699,14 @@ class Runtime:
         
         left = self._eval(node.left, scope)
         right = self._eval(node.right, scope)
-        
+
+        return self._binary_op(op, left, right, node.line)
+
+    def _binary_op(self, op: str, left: Value, right: Value, line: int = 0) -> Value:
+        """Apply a binary operator to two already-evaluated values.
+
+        Shared by the tree-walker and the bytecode VM.
+        """
         # Arithmetic
         if op == '+':
             # Auto-coerce to string if EITHER side is string (no str() needed!)
@@ -558,37 +714,37 @@ class Runtime:
                 return Value.string_val(self._to_string(left) + self._to_string(right))
             if left.type == ValueType.LIST and right.type == ValueType.LIST:
                 return Value.list_val(left.data + right.data)
-            return self._numeric_op(left, right, lambda a, b: a + b, node.line)
+            return self._numeric_op(left, right, lambda a, b: a + b, line)
         
         if op == '-':
-            return self._numeric_op(left, right, lambda a, b: a - b, node.line)
+            return self._numeric_op(left, right, lambda a, b: a - b, line)
         
         if op == '*':
             if left.type == ValueType.STRING and right.type == ValueType.INT:
                 return Value.string_val(left.data * right.data)
             if left.type == ValueType.LIST and right.type == ValueType.INT:
                 return Value.list_val(left.data * right.data)
-            return self._numeric_op(left, right, lambda a, b: a * b, node.line)
+            return self._numeric_op(left, right, lambda a, b: a * b, line)
         
         if op == '/':
             if left.type == ValueType.NULL or right.type == ValueType.NULL:
-                raise TinyTalkError("Cannot perform arithmetic on null", node.line)
+                raise TinyTalkError("Cannot perform arithmetic on null", line)
             if right.data == 0:
-                raise TinyTalkError("Division by zero", node.line)
+                raise TinyTalkError("Division by zero", line)
             return Value.float_val(left.data / right.data)
         
         if op == '//':
             if left.type == ValueType.NULL or right.type == ValueType.NULL:
-                raise TinyTalkError("Cannot perform arithmetic on null", node.line)
+                raise TinyTalkError("Cannot perform arithmetic on null", line)
             if right.data == 0:
-                raise TinyTalkError("Division by zero", node.line)
+                raise TinyTalkError("Division by zero", line)
             return Value.int_val(int(left.data // right.data))
         
         if op == '%':
-            return self._numeric_op(left, right, lambda a, b: a % b, node.line)
+            return self._numeric_op(left, right, lambda a, b: a % b, line)
         
         if op == '**':
-            return self._numeric_op(left, right, lambda a, b: a ** b, node.line)
+            return self._numeric_op(left, right, lambda a, b: a ** b, line)
         
         # Comparison
         if op == '<':
@@ -611,6 +767,8 @@ class Runtime:
         
         # has - check if container contains value
         if op == 'has':
+            if left.type == ValueType.ARRAY:
+                return Value.bool_val(right.data in left.data)
             if left.type == ValueType.LIST:
                 return Value.bool_val(any(right.data == v.data for v in left.data))
             if left.type == ValueType.MAP:
@@ -668,6 +826,8 @@ class Runtime:
         
         # In/not in
         if op == 'in':
+            if right.type == ValueType.ARRAY:
+                return Value.bool_val(left.data in right.data)
             if right.type == ValueType.LIST:
                 return Value.bool_val(any(left.data == v.data for v in right.data))
             if right.type == ValueType.MAP:
@@ -676,10 +836,14 @@ class Runtime:
                 return Value.bool_val(str(left.data) in right.data)
             return Value.bool_val(False)
         
-        raise TinyTalkError(f"Unknown operator: {op}", node.line)
+        raise TinyTalkError(f"Unknown operator: {op}", line)
     
     def _equal(self, left: Value, right: Value) -> Value:
         """Test equality with float tolerance for near-equal floats."""
+        # Identity fast path: interned values (null/bool/small ints) and
+        # self-comparison short-circuit (floats excluded to keep NaN exact)
+        if left is right and left.type != ValueType.FLOAT:
+            return Value.bool_val(True)
         # Same type comparison
         if left.type == right.type:
             # For floats, use approximate comparison
@@ -818,17 +982,20 @@ class Runtime:
     def _eval_unary(self, node: UnaryOp, scope: Scope) -> Value:
         """Evaluate unary operation."""
         operand = self._eval(node.operand, scope)
-        
-        if node.op == '-':
+        return self._unary_op(node.op, operand, node.line)
+
+    def _unary_op(self, op: str, operand: Value, line: int = 0) -> Value:
+        """Apply a unary operator to an already-evaluated value."""
+        if op == '-':
             return Value.float_val(-operand.data) if operand.type == ValueType.FLOAT else Value.int_val(-int(operand.data))
-        if node.op in ('not', '!'):
+        if op in ('not', '!'):
             return Value.bool_val(not operand.is_truthy())
-        if node.op == '~':
+        if op == '~':
             return Value.int_val(~int(operand.data))
-        if node.op == '+':
+        if op == '+':
             return operand
-        
-        raise TinyTalkError(f"Unknown unary operator: {node.op}", node.line)
+
+        raise TinyTalkError(f"Unknown unary operator: {op}", line)
     
     def _eval_call(self, node: Call, scope: Scope) -> Value:
         """Evaluate function call."""
@@ -887,21 +1054,32 @@ class Runtime:
             raise TinyTalkError(f"Exceeded maximum recursion depth ({self.bounds.max_recursion})", line)
         
         try:
+            profiler = self.profiler
+            if profiler is not None:
+                if fn.is_native:
+                    profiler.builtin_counts[fn.name] = \
+                        profiler.builtin_counts.get(fn.name, 0) + 1
+                else:
+                    profiler.call_counts[fn.name] = \
+                        profiler.call_counts.get(fn.name, 0) + 1
+
             if fn.is_native:
                 return fn.native_fn(args)
-            
+
             # Create function scope
             fn_scope = Scope(fn.closure)
-            
+
             # Bind parameters
             for i, (param_name, _) in enumerate(fn.params):
                 if i < len(args):
                     fn_scope.define(param_name, args[i])
                 else:
                     fn_scope.define(param_name, Value.null_val())
-            
-            # Execute body
+
+            # Execute body - compiled functions go through the bytecode VM
             try:
+                if fn.code is not None:
+                    return self._vm.run(fn.code, fn_scope)
                 result = self._eval(fn.body, fn_scope)
                 return result
             except ReturnException as e:
@@ -913,15 +1091,27 @@ class Runtime:
         """Evaluate index access."""
         obj = self._eval(node.obj, scope)
         index = self._eval(node.index, scope)
-        
+        return self._index_value(obj, index, node.line)
+
+    def _index_value(self, obj: Value, index: Value, line: int = 0) -> Value:
+        """Index into an already-evaluated container value."""
         if obj.type == ValueType.LIST:
             idx = int(index.data)
             if idx < 0:
                 idx = len(obj.data) + idx
             if idx < 0 or idx >= len(obj.data):
-                raise TinyTalkError(f"Index {idx} out of bounds", node.line)
+                raise TinyTalkError(f"Index {idx} out of bounds", line)
             return obj.data[idx]
         
+        if obj.type == ValueType.ARRAY:
+            idx = int(index.data)
+            if idx < 0:
+                idx = len(obj.data) + idx
+            if idx < 0 or idx >= len(obj.data):
+                raise TinyTalkError(f"Index {idx} out of bounds", line)
+            n = obj.data[idx]
+            return Value.int_val(n) if isinstance(n, int) else Value.float_val(n)
+
         if obj.type == ValueType.MAP:
             key = index.to_python()
             if key not in obj.data:
@@ -933,29 +1123,32 @@ class Runtime:
             if idx < 0:
                 idx = len(obj.data) + idx
             if idx < 0 or idx >= len(obj.data):
-                raise TinyTalkError(f"Index {idx} out of bounds", node.line)
+                raise TinyTalkError(f"Index {idx} out of bounds", line)
             return Value.string_val(obj.data[idx])
         
-        raise TinyTalkError(f"Cannot index {obj.type.value}", node.line)
+        raise TinyTalkError(f"Cannot index {obj.type.value}", line)
     
     def _eval_member(self, node: Member, scope: Scope) -> Value:
         """Evaluate member access."""
         obj = self._eval(node.obj, scope)
-        
+        return self._member_value(obj, node.field, node.line)
+
+    def _member_value(self, obj: Value, field: str, line: int = 0) -> Value:
+        """Access a member on an already-evaluated value."""
         if obj.type == ValueType.STRUCT_INSTANCE:
             instance = obj.data
             # Fields take priority over methods (Python-like)
-            if node.field in instance.fields:
-                return instance.fields[node.field]
+            if field in instance.fields:
+                return instance.fields[field]
             # Check for methods - return bound method
-            if node.field in instance.struct.methods:
-                method = instance.struct.methods[node.field]
+            if field in instance.struct.methods:
+                method = instance.struct.methods[field]
                 bound = BoundMethod(method, instance)
                 return Value(ValueType.FUNCTION, bound)
-            raise TinyTalkError(f"Unknown field '{node.field}'", node.line)
+            raise TinyTalkError(f"Unknown field '{field}'", line)
         
         if obj.type == ValueType.MAP:
-            key = node.field
+            key = field
             if key in obj.data:
                 return obj.data[key]
             return Value.null_val()
@@ -969,10 +1162,10 @@ class Runtime:
         # x.type -> type name as string
         # ═══════════════════════════════════════════════════════════════════
         
-        if node.field == 'str':
+        if field == 'str':
             return Value.string_val(self._to_string(obj))
         
-        if node.field == 'num':
+        if field == 'num':
             if obj.type == ValueType.STRING:
                 try:
                     if '.' in obj.data:
@@ -986,7 +1179,7 @@ class Runtime:
                 return Value.int_val(1 if obj.data else 0)
             return Value.int_val(0)
         
-        if node.field == 'int':
+        if field == 'int':
             if obj.type == ValueType.STRING:
                 try:
                     return Value.int_val(int(float(obj.data)))
@@ -998,7 +1191,7 @@ class Runtime:
                 return Value.int_val(1 if obj.data else 0)
             return Value.int_val(0)
         
-        if node.field == 'float':
+        if field == 'float':
             if obj.type == ValueType.STRING:
                 try:
                     return Value.float_val(float(obj.data))
@@ -1008,17 +1201,17 @@ class Runtime:
                 return Value.float_val(float(obj.data))
             return Value.float_val(0.0)
         
-        if node.field == 'bool':
+        if field == 'bool':
             return Value.bool_val(obj.is_truthy())
         
-        if node.field == 'type':
+        if field == 'type':
             return Value.string_val(obj.type.value)
         
-        # .len works on strings, lists, and maps - universal length
-        if node.field == 'len':
+        # .len works on strings, lists, arrays, and maps - universal length
+        if field == 'len':
             if obj.type == ValueType.STRING:
                 return Value.int_val(len(obj.data))
-            if obj.type == ValueType.LIST:
+            if obj.type in (ValueType.LIST, ValueType.ARRAY):
                 return Value.int_val(len(obj.data))
             if obj.type == ValueType.MAP:
                 return Value.int_val(len(obj.data))
@@ -1026,34 +1219,47 @@ class Runtime:
         
         # Built-in methods
         if obj.type == ValueType.STRING:
-            if node.field == 'length':
+            if field == 'length':
                 return Value.int_val(len(obj.data))
-            if node.field in ('upper', 'upcase'):  # Support both
+            if field in ('upper', 'upcase'):  # Support both
                 return Value.string_val(obj.data.upper())
-            if node.field in ('lower', 'lowcase'):  # Support both
+            if field in ('lower', 'lowcase'):  # Support both
                 return Value.string_val(obj.data.lower())
-            if node.field == 'trim':
+            if field == 'trim':
                 return Value.string_val(obj.data.strip())
-            if node.field == 'chars':  # Get chars as list
+            if field == 'chars':  # Get chars as list
                 return Value.list_val([Value.string_val(c) for c in obj.data])
-            if node.field == 'words':  # Split into words
+            if field == 'words':  # Split into words
                 return Value.list_val([Value.string_val(w) for w in obj.data.split()])
-            if node.field == 'lines':  # Split into lines
+            if field == 'lines':  # Split into lines
                 return Value.list_val([Value.string_val(l) for l in obj.data.splitlines()])
-            if node.field == 'reversed':  # Reverse the string
+            if field == 'reversed':  # Reverse the string
                 return Value.string_val(obj.data[::-1])
         if obj.type == ValueType.LIST:
-            if node.field == 'length':
+            if field == 'length':
                 return Value.int_val(len(obj.data))
-            if node.field == 'first':
+            if field == 'first':
                 return obj.data[0] if obj.data else Value.null_val()
-            if node.field == 'last':
+            if field == 'last':
                 return obj.data[-1] if obj.data else Value.null_val()
-            if node.field == 'empty':
+            if field == 'empty':
+                return Value.bool_val(len(obj.data) == 0)
+        if obj.type == ValueType.ARRAY:
+            if field == 'length':
+                return Value.int_val(len(obj.data))
+            if field == 'first':
+                return self._box_array_item(obj.data[0]) if len(obj.data) else Value.null_val()
+            if field == 'last':
+                return self._box_array_item(obj.data[-1]) if len(obj.data) else Value.null_val()
+            if field == 'empty':
                 return Value.bool_val(len(obj.data) == 0)
         
-        raise TinyTalkError(f"Cannot access '.{node.field}' on {obj.type.value}", node.line)
+        raise TinyTalkError(f"Cannot access '.{field}' on {obj.type.value}", line)
     
+    @staticmethod
+    def _box_array_item(n) -> Value:
+        return Value.int_val(n) if isinstance(n, int) else Value.float_val(n)
+
     def _to_string(self, val: Value, seen: set = None) -> str:
         """Convert value to string - used for auto-coercion.
         
@@ -1081,6 +1287,8 @@ class Runtime:
         if val.type == ValueType.MAP:
             pairs = ', '.join(f"{k}: {self._to_string(v, seen)}" for k, v in val.data.items())
             return f"{{{pairs}}}"
+        if val.type == ValueType.ARRAY:
+            return f"[{', '.join(str(n) for n in val.data)}]"
         return str(val.data)
     
     def _eval_if(self, node: IfStmt, scope: Scope) -> Value:
@@ -1110,6 +1318,9 @@ class Runtime:
             items = [Value.string_val(c) for c in iterable.data]
         elif iterable.type == ValueType.MAP:
             items = [Value.string_val(k) for k in iterable.data.keys()]
+        elif iterable.type == ValueType.ARRAY:
+            items = [Value.int_val(n) if isinstance(n, int) else Value.float_val(n)
+                     for n in iterable.data]
         else:
             raise TinyTalkError(f"Cannot iterate over {iterable.type.value}", node.line)
         
@@ -1171,27 +1382,186 @@ class Runtime:
     # STEP CHAIN EVALUATION - dplyr-style data manipulation
     # ═══════════════════════════════════════════════════════════════════════════════
     
+    # Element-wise stages that stream one item at a time, and terminal
+    # aggregations that can consume a stream without materializing it
+    _STREAM_STEPS = frozenset(('_filter', '_map', '_take', '_drop'))
+    _CONSUME_STEPS = frozenset(('_sum', '_avg', '_min', '_max', '_count',
+                                '_first', '_last'))
+
     def _eval_step_chain(self, node, scope: Scope) -> Value:
         """
         Evaluate step chain: data _filter _sort _take
-        
-        Steps are applied left-to-right, each transforming the data.
+
+        Steps are applied left-to-right, each transforming the data. Runs
+        of element-wise stages (filter/map/take/drop) fuse into one lazy
+        pipeline that streams a single element end-to-end - with take/first
+        short-circuiting the source - so a filter->map->take over a large
+        list allocates no intermediate lists. Structural steps (_sort,
+        _group, _zip, ...) materialize as before.
         """
-        # Start with the source data
         data = self._eval(node.source, scope)
-        
-        for step_name, step_args in node.steps:
-            # Evaluate step arguments (if any)
-            args = [self._eval(a, scope) for a in step_args]
-            
-            # Apply the step
-            data = self._apply_step(data, step_name, args, scope, node.line)
-        
+
+        steps = node.steps
+        i = 0
+        while i < len(steps):
+            step_name, step_args = steps[i]
+            if step_name in self._STREAM_STEPS and \
+                    data.type in (ValueType.LIST, ValueType.ARRAY, ValueType.STRING):
+                # Fuse the run of streamable stages (plus one consuming
+                # terminal, when it follows directly)
+                stages = []
+                j = i
+                streamable = True
+                while j < len(steps) and steps[j][0] in self._STREAM_STEPS:
+                    name = steps[j][0]
+                    args = [self._eval(a, scope) for a in steps[j][1]]
+                    if name in ('_take', '_drop') and args and int(args[0].data) < 0:
+                        streamable = False  # negative counts need the full list
+                        break
+                    stages.append((name, args))
+                    j += 1
+                if not streamable or not stages:
+                    args = [self._eval(a, scope) for a in step_args]
+                    data = self._apply_step(data, step_name, args, scope, node.line)
+                    i += 1
+                    continue
+                terminal = None
+                if j < len(steps) and steps[j][0] in self._CONSUME_STEPS:
+                    targs = [self._eval(a, scope) for a in steps[j][1]]
+                    terminal = (steps[j][0], targs)
+                    j += 1
+                data = self._run_stream(data, stages, terminal, scope, node.line)
+                i = j
+            else:
+                args = [self._eval(a, scope) for a in step_args]
+                data = self._apply_step(data, step_name, args, scope, node.line)
+                i += 1
+
         return data
+
+    def _run_stream(self, data: Value, stages, terminal, scope: Scope, line: int) -> Value:
+        """Run a fused pipeline of element-wise stages over the source."""
+        from itertools import islice
+
+        if data.type == ValueType.LIST:
+            gen = iter(data.data)
+        elif data.type == ValueType.ARRAY:
+            gen = (self._box_array_item(n) for n in data.data)
+        else:  # STRING - same coercion as _apply_step
+            gen = (Value.string_val(c) for c in data.data)
+
+        for name, args in stages:
+            if name == '_filter':
+                if not args:
+                    raise TinyTalkError("_filter requires a predicate function", line)
+                pred = args[0]
+                if pred.type != ValueType.FUNCTION:
+                    raise TinyTalkError("_filter argument must be a function", line)
+                gen = self._stream_filter(gen, pred.data, scope, line)
+            elif name == '_map':
+                if not args:
+                    raise TinyTalkError("_map requires a transform function", line)
+                fn = args[0]
+                if fn.type != ValueType.FUNCTION:
+                    raise TinyTalkError("_map argument must be a function", line)
+                gen = self._stream_map(gen, fn.data, scope, line)
+            elif name == '_take':
+                gen = islice(gen, int(args[0].data) if args else 1)
+            else:  # _drop
+                gen = islice(gen, int(args[0].data) if args else 1, None)
+
+        if terminal is None:
+            return Value.list_val(list(gen))
+
+        name, args = terminal
+        if name == '_first':
+            return next(gen, Value.null_val())
+        if name == '_last':
+            last = Value.null_val()
+            for item in gen:
+                last = item
+            return last
+        if name == '_count':
+            if args and args[0].type == ValueType.FUNCTION:
+                pred = args[0]
+                return Value.int_val(sum(
+                    1 for item in gen
+                    if self._call_function(pred.data, [item], scope, line).is_truthy()))
+            return Value.int_val(sum(1 for _ in gen))
+        if name == '_sum':
+            total = 0
+            saw_float = False
+            for item in gen:
+                if item.type in (ValueType.INT, ValueType.FLOAT):
+                    total += item.data
+                    saw_float = saw_float or item.type == ValueType.FLOAT
+            return Value.float_val(total) if saw_float else Value.int_val(int(total))
+        if name == '_avg':
+            total = 0
+            count = 0
+            for item in gen:
+                if item.type in (ValueType.INT, ValueType.FLOAT):
+                    total += item.data
+                    count += 1
+            return Value.float_val(total / count) if count else Value.null_val()
+        # _min / _max: same to_python ordering as the materialized path
+        best = None
+        best_key = None
+        for item in gen:
+            key = item.to_python()
+            if best is None or (key < best_key if name == '_min' else key > best_key):
+                best, best_key = item, key
+        return best if best is not None else Value.null_val()
+
+    def _stream_filter(self, gen, pred, scope: Scope, line: int):
+        for item in gen:
+            if self._call_function(pred, [item], scope, line).is_truthy():
+                yield item
+
+    def _stream_map(self, gen, fn, scope: Scope, line: int):
+        for item in gen:
+            yield self._call_function(fn, [item], scope, line)
     
     def _apply_step(self, data: Value, step: str, args: List[Value], scope: Scope, line: int) -> Value:
         """Apply a single step transformation."""
         
+        # Homogeneous arrays: run the numeric kernels over raw elements,
+        # skipping per-element Value boxing entirely
+        if data.type == ValueType.ARRAY:
+            arr = data.data
+            if step == '_sum':
+                return self._box_array_item(sum(arr))
+            if step == '_avg':
+                return Value.float_val(sum(arr) / len(arr)) if len(arr) else Value.null_val()
+            if step == '_min':
+                return self._box_array_item(min(arr)) if len(arr) else Value.null_val()
+            if step == '_max':
+                return self._box_array_item(max(arr)) if len(arr) else Value.null_val()
+            if step == '_count' and not args:
+                return Value.int_val(len(arr))
+            if step == '_take':
+                return Value.array_val(arr[:int(args[0].data) if args else 1])
+            if step == '_drop':
+                return Value.array_val(arr[int(args[0].data) if args else 1:])
+            if step == '_reverse':
+                return Value.array_val(arr[::-1])
+            if step == '_sort' and not args:
+                return Value.array_val(type(arr)(arr.typecode, sorted(arr)))
+            if step == '_first':
+                return self._box_array_item(arr[0]) if len(arr) else Value.null_val()
+            if step == '_last':
+                return self._box_array_item(arr[-1]) if len(arr) else Value.null_val()
+            if step == '_unique':
+                return Value.array_val(type(arr)(arr.typecode, dict.fromkeys(arr)))
+            if step == '_filter' and args and args[0].type == ValueType.FUNCTION:
+                pred = args[0].data
+                kept = [n for n in arr
+                        if self._call_function(pred, [self._box_array_item(n)],
+                                               scope, line).is_truthy()]
+                return Value.array_val(type(arr)(arr.typecode, kept))
+            # Remaining steps work on boxed elements
+            data = Value.list_val([self._box_array_item(n) for n in arr])
+
         # Ensure we have a list to work with
         if data.type != ValueType.LIST:
             if data.type == ValueType.STRING:
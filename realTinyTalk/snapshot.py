@@ -0,0 +1,106 @@
+"""
+═══════════════════════════════════════════════════════════════════════════════
+TINYTALK AST SNAPSHOT
+Versioned binary serialization of parsed ASTs
+
+Parse once at save time, deserialize on cold start.
+═══════════════════════════════════════════════════════════════════════════════
+"""
+
+import marshal
+from pathlib import Path
+from typing import Any, Optional
+
+from . import parser as _parser
+from .parser import ASTNode
+
+# Format: MAGIC + version byte + 64-byte source sha256 (ascii) + marshal body.
+# Any mismatch (magic, version, hash) makes the loader refuse, so a stale or
+# foreign snapshot silently falls back to a normal parse.
+SNAPSHOT_MAGIC = b"TTAS"
+SNAPSHOT_VERSION = 1
+
+# Node registry: every ASTNode subclass the parser can produce, by class name
+_NODE_CLASSES = {
+    cls.__name__: cls
+    for cls in vars(_parser).values()
+    if isinstance(cls, type) and issubclass(cls, ASTNode)
+}
+
+
+def _encode(value: Any) -> Any:
+    """Lower an AST value to marshal-able primitives."""
+    if isinstance(value, ASTNode):
+        fields = {
+            k: _encode(v) for k, v in vars(value).items()
+            if k != 'type'  # NodeType is recomputed by __post_init__
+        }
+        return ('N', type(value).__name__, fields)
+    if isinstance(value, list):
+        return ('L', [_encode(v) for v in value])
+    if isinstance(value, tuple):
+        return ('T', [_encode(v) for v in value])
+    return value
+
+
+def _decode(value: Any) -> Any:
+    """Rebuild an AST value from its encoded form."""
+    if isinstance(value, tuple):
+        tag = value[0]
+        if tag == 'N':
+            cls = _NODE_CLASSES.get(value[1])
+            if cls is None:
+                raise ValueError(f"Unknown node class in snapshot: {value[1]}")
+            fields = {k: _decode(v) for k, v in value[2].items()}
+            return cls(**fields)
+        if tag == 'L':
+            return [_decode(v) for v in value[1]]
+        if tag == 'T':
+            return tuple(_decode(v) for v in value[1])
+    return value
+
+
+def dump_ast(ast: ASTNode, source_hash: str) -> bytes:
+    """Serialize an AST to snapshot bytes, bound to its source hash."""
+    body = marshal.dumps(_encode(ast))
+    return (SNAPSHOT_MAGIC
+            + bytes([SNAPSHOT_VERSION])
+            + source_hash.encode('ascii')
+            + body)
+
+
+def load_ast(data: bytes, source_hash: str) -> ASTNode:
+    """Deserialize snapshot bytes; raises ValueError on any mismatch."""
+    head = len(SNAPSHOT_MAGIC)
+    if data[:head] != SNAPSHOT_MAGIC:
+        raise ValueError("Not a TinyTalk AST snapshot")
+    if data[head] != SNAPSHOT_VERSION:
+        raise ValueError(f"Snapshot version {data[head]} != {SNAPSHOT_VERSION}")
+    stored_hash = data[head + 1:head + 65].decode('ascii')
+    if stored_hash != source_hash:
+        raise ValueError("Snapshot does not match source hash")
+    return _decode(marshal.loads(data[head + 65:]))
+
+
+def save_snapshot(path, ast: ASTNode, source_hash: str) -> bool:
+    """Write a snapshot file; best-effort, returns False on failure."""
+    try:
+        Path(path).write_bytes(dump_ast(ast, source_hash))
+        return True
+    except OSError:
+        return False
+
+
+def load_snapshot(path, source_hash: str) -> Optional[ASTNode]:
+    """Load a snapshot if present and matching; None means 'parse instead'.
+
+    Any failure - missing file, truncation (IndexError slicing the
+    header), marshal corruption, or a node field-schema mismatch
+    (TypeError in cls(**fields)) - falls back to parsing, as the format
+    contract promises.
+    """
+    try:
+        data = Path(path).read_bytes()
+        return load_ast(data, source_hash)
+    except Exception:
+        return None
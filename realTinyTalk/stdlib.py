@@ -70,6 +70,8 @@ def _format_value(val: Value, seen: set = None) -> str:
     if val.type == ValueType.MAP:
         pairs = ', '.join(f"{k}: {_format_value(v, seen)}" for k, v in val.data.items())
         return f"{{{pairs}}}"
+    if val.type == ValueType.ARRAY:
+        return f"[{', '.join(str(n) for n in val.data)}]"
     return str(val.data)
 
 
@@ -100,6 +102,8 @@ def builtin_len(args: List[Value]) -> Value:
         return Value.int_val(len(val.data))
     if val.type == ValueType.MAP:
         return Value.int_val(len(val.data))
+    if val.type == ValueType.ARRAY:
+        return Value.int_val(len(val.data))
     return Value.int_val(0)
 
 
@@ -264,6 +268,29 @@ def builtin_values(args: List[Value]) -> Value:
     return Value.list_val(list(args[0].data.values()))
 
 
+def _box_number(n) -> Value:
+    """Box a raw array element back into a Value."""
+    return Value.float_val(n) if isinstance(n, float) else Value.int_val(n)
+
+
+def builtin_array(args: List[Value]) -> Value:
+    """Build a homogeneous numeric array from a list (or copy an array).
+
+    Ints pack as 64-bit integers; any float promotes the whole array to
+    doubles. Non-numeric elements are skipped, matching sum()'s tolerance.
+    """
+    if not args:
+        return Value.array_from_numbers([])
+    src = args[0]
+    if src.type == ValueType.ARRAY:
+        return Value.array_val(src.data[:])
+    if src.type != ValueType.LIST:
+        return Value.array_from_numbers([])
+    numbers = [v.data for v in src.data
+               if v.type in (ValueType.INT, ValueType.FLOAT)]
+    return Value.array_from_numbers(numbers)
+
+
 def builtin_contains(args: List[Value]) -> Value:
     """Check if collection contains item."""
     if len(args) < 2:
@@ -291,6 +318,8 @@ def builtin_slice(args: List[Value]) -> Value:
     start = int(args[1].data) if len(args) > 1 else 0
     end = int(args[2].data) if len(args) > 2 else None
     
+    if val.type == ValueType.ARRAY:
+        return Value.array_val(val.data[start:end])
     if val.type == ValueType.LIST:
         sliced = val.data[start:end]
         return Value.list_val(sliced)
@@ -307,6 +336,8 @@ def builtin_reverse(args: List[Value]) -> Value:
         return Value.null_val()
     
     val = args[0]
+    if val.type == ValueType.ARRAY:
+        return Value.array_val(val.data[::-1])
     if val.type == ValueType.LIST:
         return Value.list_val(val.data[::-1])
     if val.type == ValueType.STRING:
@@ -316,7 +347,10 @@ def builtin_reverse(args: List[Value]) -> Value:
 
 
 def builtin_sort(args: List[Value]) -> Value:
-    """Sort a list."""
+    """Sort a list or array."""
+    if args and args[0].type == ValueType.ARRAY:
+        arr = args[0].data
+        return Value.array_val(type(arr)(arr.typecode, sorted(arr)))
     if not args or args[0].type != ValueType.LIST:
         return Value.list_val([])
     
@@ -459,8 +493,12 @@ def builtin_join(args: List[Value]) -> Value:
 # ═══════════════════════════════════════════════════════════════════════════════
 
 def builtin_sum(args: List[Value]) -> Value:
-    """Sum numbers in list."""
-    if not args or args[0].type != ValueType.LIST:
+    """Sum numbers in list or array."""
+    if not args:
+        return Value.int_val(0)
+    if args[0].type == ValueType.ARRAY:
+        return _box_number(sum(args[0].data))
+    if args[0].type != ValueType.LIST:
         return Value.int_val(0)
     
     total = sum(v.data for v in args[0].data if v.type in (ValueType.INT, ValueType.FLOAT))
@@ -474,6 +512,10 @@ def builtin_min(args: List[Value]) -> Value:
     if not args:
         return Value.null_val()
     
+    if args[0].type == ValueType.ARRAY:
+        if not len(args[0].data):
+            return Value.null_val()
+        return _box_number(min(args[0].data))
     if args[0].type == ValueType.LIST:
         if not args[0].data:
             return Value.null_val()
@@ -490,6 +532,10 @@ def builtin_max(args: List[Value]) -> Value:
     if not args:
         return Value.null_val()
     
+    if args[0].type == ValueType.ARRAY:
+        if not len(args[0].data):
+            return Value.null_val()
+        return _box_number(max(args[0].data))
     if args[0].type == ValueType.LIST:
         if not args[0].data:
             return Value.null_val()
@@ -786,6 +832,7 @@ STDLIB_FUNCTIONS = {
     
     # Math
     'sum': builtin_sum,
+    'array': builtin_array,
     'min': builtin_min,
     'max': builtin_max,
     'abs': builtin_abs,
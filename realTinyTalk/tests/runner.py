@@ -63,6 +63,7 @@ FILE_CATEGORIES = {
     "15_algorithms": TestCategory.CORE,
     "16_edge_cases": TestCategory.CORE,
     "17_metatests": TestCategory.META,
+    "18_arrays": TestCategory.STDLIB,
 }
 
 
@@ -170,7 +171,7 @@ def parse_test_file(content: str, filename: str) -> List[Tuple[str, str, str, in
 # =============================================================================
 
 def run_test(name: str, code: str, expected: str, file: str, line: int, 
-             category: TestCategory) -> TestResult:
+             category: TestCategory, engine: str = 'ast') -> TestResult:
     """Run a single test and return detailed result."""
     start = time.time()
     
@@ -178,7 +179,7 @@ def run_test(name: str, code: str, expected: str, file: str, line: int,
     
     try:
         with redirect_stdout(stdout_capture):
-            run(code)
+            run(code, engine=engine)
         
         actual = stdout_capture.getvalue().strip()
         expected_clean = expected.strip()
@@ -242,7 +243,7 @@ def run_test(name: str, code: str, expected: str, file: str, line: int,
         )
 
 
-def run_suite(path: Path) -> SuiteResult:
+def run_suite(path: Path, engine: str = 'ast') -> SuiteResult:
     """Run all tests in a file."""
     start = time.time()
     
@@ -255,7 +256,7 @@ def run_suite(path: Path) -> SuiteResult:
     
     results = []
     for name, code, expected, line in tests:
-        result = run_test(name, code, expected, path.name, line, category)
+        result = run_test(name, code, expected, path.name, line, category, engine)
         results.append(result)
     
     return SuiteResult(
@@ -440,6 +441,9 @@ Examples:
                         help='Run only tests in category')
     parser.add_argument('--max-failures', type=int, default=10,
                         help='Maximum failures to display')
+    parser.add_argument('--engine', type=str, default='both',
+                        choices=['ast', 'vm', 'both'],
+                        help='Execution engine(s) to run the suite under')
     parser.add_argument('files', nargs='*', help='Specific test files to run')
     
     args = parser.parse_args()
@@ -473,20 +477,26 @@ Examples:
             if FILE_CATEGORIES.get(f.stem, TestCategory.CORE) == target_cat
         ]
     
-    # Run suites
+    # Run suites - under both engines by default, so the bytecode VM and
+    # its slot resolver are guarded by the same conformance net as the
+    # tree-walker
+    engines = ['ast', 'vm'] if args.engine == 'both' else [args.engine]
     suites = []
-    for path in test_files:
-        suite = run_suite(path)
-        
-        # Filter results by name pattern
-        if args.filter:
-            suite.results = [
-                r for r in suite.results 
-                if fnmatch.fnmatch(r.name.lower(), f'*{args.filter.lower()}*')
-            ]
-        
-        if suite.results:  # Only add if has matching tests
-            suites.append(suite)
+    for engine in engines:
+        for path in test_files:
+            suite = run_suite(path, engine)
+            if len(engines) > 1:
+                suite.name = f"{suite.name} [{engine}]"
+            
+            # Filter results by name pattern
+            if args.filter:
+                suite.results = [
+                    r for r in suite.results 
+                    if fnmatch.fnmatch(r.name.lower(), f'*{args.filter.lower()}*')
+                ]
+            
+            if suite.results:  # Only add if has matching tests
+                suites.append(suite)
     
     if not suites:
         print("No tests matched filters!")
@@ -0,0 +1,203 @@
+"""
+═══════════════════════════════════════════════════════════════
+ACID TEST: Kernel
+Ledger hash chain, bounded retention, and spill behavior
+═══════════════════════════════════════════════════════════════
+"""
+
+import sys
+import tempfile
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent.parent.parent))
+
+from realTinyTalk.kernel import (
+    CanonicalHasher, Compiler, Ledger, Trace, TracePolicy, TraceLog,
+    TinyTalkKernel, sha256, stable_json
+)
+
+
+def check(name: str, ok: bool) -> bool:
+    print(f"{'✅' if ok else '❌'} {name}")
+    return ok
+
+
+def run_all_tests():
+    """Run all kernel tests."""
+    print("=" * 60)
+    print("KERNEL ACID TEST")
+    print("=" * 60)
+    print()
+
+    passed = 0
+    failed = 0
+
+    def record(ok):
+        nonlocal passed, failed
+        if ok:
+            passed += 1
+        else:
+            failed += 1
+
+    # ── Unbounded ledger (default behavior) ──
+    led = Ledger()
+    for i in range(10):
+        led.append("op", {"n": i}, {"n": i * 2})
+    record(check("Unbounded keeps all entries", len(led) == 10))
+    record(check("Unbounded chain verifies", led.verify_chain()))
+    record(check("First entry links to GENESIS", led.entries[0].prev_hash == "GENESIS"))
+    record(check("Head hash is newest entry", led.head_hash == led.entries[-1].hash))
+
+    # Tampering breaks verification
+    led2 = Ledger()
+    for i in range(5):
+        led2.append("op", {"n": i}, {})
+    led2.entries[2] = led2.entries[2].__class__(
+        index=2, timestamp=0.0, operation="op", input_hash="x",
+        output_hash="x", prev_hash="FORGED", hash=led2.entries[2].hash)
+    record(check("Tampered prev_hash fails verification", not led2.verify_chain()))
+
+    # ── Bounded ring ──
+    ring = Ledger(max_entries=4)
+    for i in range(20):
+        ring.append("op", {"n": i}, {})
+    record(check("Ring retains max_entries", len(ring) == 4))
+    record(check("Ring counts total appends", ring.total_appended == 20))
+    record(check("Ring indices keep advancing", ring.entries[-1].index == 19))
+    record(check("Ring chain verifies via checkpoint", ring.verify_chain()))
+    record(check("Checkpoint is last evicted hash",
+                 ring.checkpoint_hash == ring.entries[0].prev_hash))
+
+    # ── Spill to disk ──
+    with tempfile.TemporaryDirectory() as tmp:
+        spill = str(Path(tmp) / "ledger.jsonl")
+        spilled = Ledger(max_entries=3, spill_path=spill)
+        for i in range(10):
+            spilled.append("op", {"n": i}, {})
+        lines = Path(spill).read_text().strip().split("\n")
+        record(check("Spill holds evicted entries", len(lines) == 7))
+        record(check("Spilled chain verifies", spilled.verify_spill()))
+        record(check("Retained chain verifies after spill", spilled.verify_chain()))
+
+    # No spill configured is trivially valid
+    record(check("verify_spill without spill_path", Ledger().verify_spill()))
+
+    # ── Canonical hashing (ledger v2) ──
+    ch = CanonicalHasher()
+    record(check("Canonical hash is key-order independent",
+                 ch.hash({"a": 1, "b": 2}) == CanonicalHasher().hash({"b": 2, "a": 1})))
+    record(check("Canonical hash distinguishes types",
+                 ch.hash(1) != ch.hash(1.0) != ch.hash("1")))
+    shared = list(range(1000))
+    ch2 = CanonicalHasher()
+    ch2.hash({"data": shared})
+    record(check("Memo reuses substructure digests",
+                 id(shared) in ch2._memo))
+    record(check("Default ledger keeps v1 stable_json hashes",
+                 Ledger().append("op", {"x": 1}, {}).input_hash
+                 == sha256(stable_json({"x": 1}))))
+    v2 = Ledger(hash_version=2)
+    for i in range(10):
+        v2.append("op", {"n": i}, {"shared": shared})
+    record(check("v2 ledger chain verifies", v2.verify_chain()))
+    # Regression: a stale id-keyed memo once collapsed distinct transient
+    # inputs onto 2 hashes - every hash must commit to content
+    record(check("v2 hashes are distinct per distinct input",
+                 len({e.input_hash for e in v2.entries}) == 10))
+    record(check("v2 hashes match a fresh recompute",
+                 all(e.input_hash == CanonicalHasher().hash({"n": i})
+                     for i, e in enumerate(v2.entries))))
+
+    # ── Trace policies ──
+    full = TraceLog()
+    for i in range(50):
+        full.add(Trace.t("step", True))
+    record(check("Full policy keeps everything", len(full.entries()) == 50))
+
+    ring = TraceLog(TracePolicy(mode="ring", ring_size=8))
+    for i in range(50):
+        ring.add(Trace.t(f"step{i}", True))
+    record(check("Ring policy keeps newest ring_size", len(ring.entries()) == 8))
+    record(check("Ring keeps the tail", ring.entries()[-1].step == "step49"))
+    record(check("Ring counts drops", ring.dropped == 42))
+
+    sampled = TraceLog(TracePolicy(mode="sample", sample_every=10))
+    for i in range(100):
+        sampled.add(Trace.t("ok-step", True))
+    sampled.add(Trace.t("boom", False))
+    kept = sampled.entries()
+    record(check("Sample policy thins ok traces", len(kept) == 11))
+    record(check("Sample policy always keeps failures",
+                 any(t.step == "boom" for t in kept)))
+
+    counted = TraceLog(TracePolicy(mode="count"))
+    for i in range(1000):
+        counted.add(Trace.t("hot", True))
+    summary = counted.entries()
+    record(check("Count policy stores nothing but counts",
+                 len(summary) == 1 and summary[0].meta["by_step"]["hot"] == 1000))
+
+    # Kernel wiring: count mode still produces a verifiable result
+    k = TinyTalkKernel(trace_policy=TracePolicy(mode="count"))
+    res = k.run("1 + 2")
+    record(check("Kernel runs under count policy",
+                 bool(res) and res.value.data == 3))
+    record(check("Kernel count trace is a summary",
+                 len(res.trace) == 1 and res.trace[0].step == "trace:summary"))
+
+    # ── AST snapshots ──
+    from realTinyTalk import snapshot, Runtime
+    import io
+    from contextlib import redirect_stdout
+
+    src = 'fn add(a, b) { reply a + b }\nshow(add(2, 3))'
+    with tempfile.TemporaryDirectory() as tmp:
+        snap = str(Path(tmp) / "script.ast")
+        comp = Compiler()
+
+        first = comp.compile(src, snapshot_path=snap)
+        record(check("First compile parses and writes snapshot",
+                     bool(first) and Path(snap).exists()
+                     and any(t.step == "compile:snapshot_write" for t in first.trace)))
+
+        second = comp.compile(src, snapshot_path=snap)
+        record(check("Second compile loads from snapshot",
+                     bool(second) and any(t.step == "compile:snapshot" for t in second.trace)
+                     and not any(t.step == "compile:parse" for t in second.trace)))
+
+        buf = io.StringIO()
+        with redirect_stdout(buf):
+            Runtime().execute(second.value)
+        record(check("Snapshot AST executes identically", buf.getvalue().strip() == "5"))
+
+        # Edited source: hash mismatch must force a reparse
+        third = comp.compile(src + "\nshow(1)", snapshot_path=snap)
+        record(check("Stale snapshot falls back to parsing",
+                     bool(third) and any(t.step == "compile:parse" for t in third.trace)))
+
+        # Corrupt snapshot must not poison compilation
+        Path(snap).write_bytes(b"TTAS\x01" + b"junk" * 30)
+        fourth = comp.compile(src, snapshot_path=snap)
+        record(check("Corrupt snapshot falls back to parsing",
+                     bool(fourth) and any(t.step == "compile:parse" for t in fourth.trace)))
+
+        # Truncated snapshot (valid magic, missing version/hash) likewise
+        Path(snap).write_bytes(b"TTAS")
+        fifth = comp.compile(src, snapshot_path=snap)
+        record(check("Truncated snapshot falls back to parsing",
+                     bool(fifth) and any(t.step == "compile:parse" for t in fifth.trace)))
+
+    # ═══════════════════════════════════════════════════════════════
+    # SUMMARY
+    # ═══════════════════════════════════════════════════════════════
+    print()
+    print("=" * 60)
+    print(f"RESULTS: {passed} passed, {failed} failed")
+    print("=" * 60)
+
+    return failed == 0
+
+
+if __name__ == "__main__":
+    success = run_all_tests()
+    sys.exit(0 if success else 1)
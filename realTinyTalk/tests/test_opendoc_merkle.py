@@ -0,0 +1,184 @@
+"""
+═══════════════════════════════════════════════════════════════
+ACID TEST: OpenDoc Merkle tree
+Incremental root math, dirty tracking, and tamper detection
+═══════════════════════════════════════════════════════════════
+
+DocumentMerkle is foghorn-independent, so it is tested directly; the
+verify flow is driven through the document builtins with the foghorn
+layer stubbed out.
+"""
+
+import hashlib
+import random
+import re
+import sys
+import types
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent.parent.parent))
+
+
+def _stub_foghorn():
+    """Install stub foghorn modules so opendoc_stdlib imports."""
+    for fname in ('foghorn_stdlib.py', 'opendoc_stdlib.py'):
+        text = (Path(__file__).parent.parent / fname).read_text()
+        for mod, body in re.findall(r'from (foghorn(?:\.\w+)?) import \(([^)]*)\)', text):
+            names = [x.strip().rstrip(',')
+                     for x in body.replace('\n', ',').split(',') if x.strip()]
+            stub = sys.modules.get(mod)
+            if stub is None:
+                stub = types.ModuleType(mod)
+                stub.__path__ = []
+                sys.modules[mod] = stub
+            for n in names:
+                setattr(stub, n,
+                        type(n, (), {}) if n[0].isupper() else (lambda *a, **k: None))
+
+
+_stub_foghorn()
+
+from realTinyTalk.opendoc_stdlib import DocumentMerkle  # noqa: E402
+import realTinyTalk.opendoc_stdlib as OD  # noqa: E402
+from realTinyTalk.types import Value  # noqa: E402
+
+
+def reference_root(leaves):
+    """Full bottom-up recompute, for pinning the incremental root."""
+    if not leaves:
+        return hashlib.sha256(b'empty').hexdigest()
+    row = list(leaves)
+    while len(row) > 1:
+        nxt = []
+        for i in range(0, len(row), 2):
+            left = row[i]
+            right = row[i + 1] if i + 1 < len(row) else left
+            nxt.append(hashlib.sha256((left + right).encode()).hexdigest())
+        row = nxt
+    return row[0]
+
+
+def check(name: str, ok: bool) -> bool:
+    print(f"{'✅' if ok else '❌'} {name}")
+    return ok
+
+
+class FakeDoc:
+    def __init__(self, h):
+        self.hash = h
+
+
+class FakePart:
+    def __init__(self, h, content):
+        self.hash = h
+        self.content = content
+
+    def to_dict(self):
+        return {"hash": self.hash, "content": self.content}
+
+
+def run_all_tests():
+    print("=" * 60)
+    print("OPENDOC MERKLE ACID TEST")
+    print("=" * 60)
+    print()
+
+    passed = 0
+    failed = 0
+
+    def record(ok):
+        nonlocal passed, failed
+        if ok:
+            passed += 1
+        else:
+            failed += 1
+
+    # ── Randomized add/update fuzz vs a reference full recompute ──
+    random.seed(3)
+    tree = DocumentMerkle()
+    leaves = []
+    mismatches = 0
+    for step in range(500):
+        if leaves and random.random() < 0.3:
+            i = random.randrange(len(leaves))
+            h = f"part{random.randint(0, 10**9)}"
+            leaves[i] = h
+            tree.update_leaf(i, h)
+        else:
+            h = f"part{len(leaves)}"
+            leaves.append(h)
+            tree.add_part(f"id{len(leaves)}", None, h)
+        if random.random() < 0.2 and tree.root() != reference_root(leaves):
+            mismatches += 1
+    if tree.root() != reference_root(leaves):
+        mismatches += 1
+    record(check("500-step add/update fuzz matches full recompute",
+                 mismatches == 0))
+
+    # ── Incremental cost: one edit in a large tree is O(log n) ──
+    big = DocumentMerkle()
+    for i in range(5000):
+        big.add_part(f"p{i}", None, f"h{i}")
+    big.root()
+    big.update_leaf(2500, "edited")
+    big.root()
+    record(check("Single edit recomputes ~log2(n) nodes",
+                 0 < big.last_recomputed <= 14))
+    big.root()
+    record(check("Clean root recomputes nothing", big.last_recomputed == 0))
+
+    # ── Verify through the builtins: tampering must fail ──
+    OD.create_document = lambda title: FakeDoc("doc1")
+    OD.embed_part = lambda doc, part, container=None: "doc1"
+    OD._session_docs.clear()
+    OD._session_parts.clear()
+    OD._session_merkle.clear()
+
+    OD.builtin_document_new([Value.string_val("Report")])
+    parts = []
+    for i in range(4):
+        p = FakePart(f"part{i}", f"content {i}")
+        parts.append(p)
+        OD._session_parts[p.hash] = p
+        OD.builtin_document_add([Value.string_val("doc1"),
+                                 Value.string_val(p.hash)])
+
+    res = OD.builtin_document_verify([Value.string_val("doc1")])
+    record(check("Untampered document verifies",
+                 res.data['verified'].data
+                 and all(r.data['verified'].data for r in res.data['parts'].data)))
+    record(check("Verify reports per-part results",
+                 len(res.data['parts'].data) == 4))
+
+    # Tamper with one part's content in place
+    parts[2].content = "TAMPERED"
+    res = OD.builtin_document_verify([Value.string_val("doc1")])
+    flags = {r.data['part'].data: r.data['verified'].data
+             for r in res.data['parts'].data}
+    record(check("Tampered part fails verification",
+                 not res.data['verified'].data and flags['part2'] is False))
+    record(check("Other parts still verify",
+                 flags['part0'] and flags['part1'] and flags['part3']))
+
+    # Re-embedding the amended part re-baselines its leaf (update_leaf path)
+    OD.builtin_document_add([Value.string_val("doc1"),
+                             Value.string_val("part2")])
+    res = OD.builtin_document_verify([Value.string_val("doc1")])
+    record(check("Re-embedded part verifies against its new content",
+                 res.data['verified'].data
+                 and len(res.data['parts'].data) == 4))
+
+    # ═══════════════════════════════════════════════════════════════
+    # SUMMARY
+    # ═══════════════════════════════════════════════════════════════
+    print()
+    print("=" * 60)
+    print(f"RESULTS: {passed} passed, {failed} failed")
+    print("=" * 60)
+
+    return failed == 0
+
+
+if __name__ == "__main__":
+    success = run_all_tests()
+    sys.exit(0 if success else 1)
@@ -7,6 +7,7 @@ Types are verified, not assumed.
 ═══════════════════════════════════════════════════════════════════════════════
 """
 
+from array import array
 from dataclasses import dataclass, field
 from enum import Enum, auto
 from typing import List, Optional, Dict, Any, Union, Set
@@ -185,21 +186,35 @@ class ValueType(Enum):
     NULL = "null"
     LIST = "list"
     MAP = "map"
+    ARRAY = "array"          # homogeneous numeric array (array-module backed)
     FUNCTION = "function"
     STRUCT_INSTANCE = "struct_instance"
     ENUM_VARIANT = "enum_variant"
 
 
-@dataclass
 class Value:
-    """Runtime value with type."""
-    type: ValueType
-    data: Any
-    verified: bool = True
-    
+    """Runtime value with type.
+
+    Compact __slots__ layout (no per-instance dict), with interned
+    singletons for null/true/false and a small-int cache: allocation-heavy
+    loops produce these constantly and they are immutable, so every
+    consumer can share one object. Never mutate type/data/verified on a
+    Value that may be interned.
+    """
+
+    __slots__ = ('type', 'data', 'verified')
+
+    def __init__(self, type: ValueType, data: Any, verified: bool = True):
+        self.type = type
+        self.data = data
+        self.verified = verified
+
     @classmethod
     def int_val(cls, n: int) -> 'Value':
-        return cls(ValueType.INT, int(n))
+        n = int(n)
+        if _SMALL_INT_MIN <= n < _SMALL_INT_MAX:
+            return _SMALL_INTS[n - _SMALL_INT_MIN]
+        return cls(ValueType.INT, n)
     
     @classmethod
     def float_val(cls, n: float) -> 'Value':
@@ -211,15 +226,29 @@ class Value:
     
     @classmethod
     def bool_val(cls, b: bool) -> 'Value':
-        return cls(ValueType.BOOLEAN, bool(b))
+        return _TRUE if b else _FALSE
     
     @classmethod
     def null_val(cls) -> 'Value':
-        return cls(ValueType.NULL, None)
+        return _NULL
     
     @classmethod
     def list_val(cls, items: List['Value']) -> 'Value':
         return cls(ValueType.LIST, items)
+
+    @classmethod
+    def array_val(cls, arr: array) -> 'Value':
+        """Homogeneous numeric array: data is an array.array ('q' or 'd'),
+        so analytics kernels can run without per-element Value boxing."""
+        return cls(ValueType.ARRAY, arr)
+
+    @classmethod
+    def array_from_numbers(cls, numbers: list) -> 'Value':
+        """Build an array value from raw Python numbers (ints -> 'q',
+        anything with a float -> 'd')."""
+        if any(isinstance(n, float) for n in numbers):
+            return cls(ValueType.ARRAY, array('d', [float(n) for n in numbers]))
+        return cls(ValueType.ARRAY, array('q', numbers))
     
     @classmethod
     def map_val(cls, pairs: Dict[Any, 'Value']) -> 'Value':
@@ -242,6 +271,8 @@ class Value:
             return len(self.data) > 0
         if self.type == ValueType.MAP:
             return len(self.data) > 0
+        if self.type == ValueType.ARRAY:
+            return len(self.data) > 0
         return True
     
     def __repr__(self) -> str:
@@ -254,6 +285,9 @@ class Value:
         if self.type == ValueType.LIST:
             items = ", ".join(repr(v) for v in self.data)
             return f"[{items}]"
+        if self.type == ValueType.ARRAY:
+            items = ", ".join(str(n) for n in self.data)
+            return f"[{items}]"
         if self.type == ValueType.MAP:
             pairs = ", ".join(f"{k}: {repr(v)}" for k, v in self.data.items())
             return f"{{{pairs}}}"
@@ -267,11 +301,23 @@ class Value:
             return None
         if self.type == ValueType.LIST:
             return [v.to_python() for v in self.data]
+        if self.type == ValueType.ARRAY:
+            return list(self.data)
         if self.type == ValueType.MAP:
             return {k: v.to_python() for k, v in self.data.items()}
         return self.data
 
 
+# Interned immutable values (see Value docstring)
+_NULL = Value(ValueType.NULL, None)
+_TRUE = Value(ValueType.BOOLEAN, True)
+_FALSE = Value(ValueType.BOOLEAN, False)
+_SMALL_INT_MIN = -5
+_SMALL_INT_MAX = 257
+_SMALL_INTS = [Value(ValueType.INT, i)
+               for i in range(_SMALL_INT_MIN, _SMALL_INT_MAX)]
+
+
 # ═══════════════════════════════════════════════════════════════════════════════
 # TYPE CHECKER
 # ═══════════════════════════════════════════════════════════════════════════════
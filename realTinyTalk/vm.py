@@ -0,0 +1,1043 @@
+"""
+═══════════════════════════════════════════════════════════════════════════════
+TINYTALK BYTECODE VM
+Flat instruction stream + stack machine for hot scripts
+
+Compile once, dispatch on small integers instead of node classes.
+═══════════════════════════════════════════════════════════════════════════════
+"""
+
+from dataclasses import dataclass, field
+from typing import Any, List, Tuple
+import time
+
+from .types import Value, ValueType
+
+# Interned booleans for the comparison fast path
+_TRUE = Value.bool_val(True)
+_FALSE = Value.bool_val(False)
+from .parser import (
+    Program, Literal, Identifier, BinaryOp, UnaryOp, Call, Index, Member,
+    Array, MapLiteral, Lambda, Conditional, Range, LetStmt, ConstStmt,
+    Block, IfStmt, ForStmt, WhileStmt, ReturnStmt, BreakStmt, ContinueStmt,
+    FnDecl, AssignStmt, ImportStmt
+)
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# OPCODES
+# ═══════════════════════════════════════════════════════════════════════════════
+
+LOAD_CONST = 1      # arg: Value                  push constant
+LOAD_NAME = 2       # arg: (name, line)           push variable
+STORE_NAME = 3      # arg: name                   peek -> set-or-define variable
+DEFINE_NAME = 4     # arg: name                   peek -> define in current scope
+DEFINE_CONST = 5    # arg: name                   peek -> define constant
+POP = 6             #                             discard top of stack
+JUMP = 7            # arg: target
+JUMP_IF_FALSE = 8   # arg: target                 pop, jump when not truthy
+BINARY = 9          # arg: (op, line)             pop rhs, lhs -> push result
+UNARY = 10          # arg: (op, line)
+CALL = 11           # arg: (argc, line)           pop args, callee -> push result
+MAKE_LIST = 12      # arg: n
+MAKE_MAP = 13       # arg: n                      pops n (key, value) pairs
+GET_INDEX = 14      # arg: line
+SET_INDEX = 15      # arg: line                   pops value, index, obj
+GET_MEMBER = 16     # arg: (field, line)
+SET_MEMBER = 17     # arg: (field, line)          pops value, obj
+MAKE_RANGE = 18     # arg: inclusive              pops end, start
+MAKE_FUNCTION = 19  # arg: (name, params, body, code)
+RETURN = 20         #                             pop -> raise ReturnException
+TRUTH = 21          #                             pop -> push bool of truthiness
+PUSH_SCOPE = 22     #                             enter child scope (blocks)
+POP_SCOPE = 23      #                             leave child scope
+SETUP_WHILE = 24    # arg: (continue_target, break_target)
+SETUP_FOR = 25      # arg: (var, continue_target, break_target, line)  pops iterable
+FOR_NEXT = 26       # arg: (exit_target, line)    advance loop or jump out
+LOOP_TICK = 27      # arg: line                   count a while-loop iteration
+LOOP_ACC = 28       #                             pop -> remember as loop result
+END_LOOP = 29       #                             pop frame, push loop result
+BREAK_LOOP = 30     #                             unwind to innermost break target
+CONTINUE_LOOP = 31  #                             unwind to innermost continue target
+EVAL_NODE = 32      # arg: AST node               escape hatch to the tree-walker
+LOAD_LOCAL = 33     # arg: (slot, name, line)     push from flat locals, scope fallback
+STORE_LOCAL = 34    # arg: (slot, name)           peek -> flat locals, scope fallback
+DEFINE_LOCAL = 35   # arg: slot                   peek -> flat locals
+UNBIND_LOCAL = 36   # arg: slot                   clear slot (loop var at loop exit)
+
+
+@dataclass
+class CodeObject:
+    """A compiled unit: flat instruction stream for the VM."""
+    name: str = "<module>"
+    instructions: List[Tuple[int, Any]] = field(default_factory=list)
+    # Names promoted to flat frame slots by the resolver; slot i = local_names[i]
+    local_names: List[str] = field(default_factory=list)
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# SLOT RESOLVER
+# ═══════════════════════════════════════════════════════════════════════════════
+# A static pass over a compilation unit that decides which variables can live
+# in a flat per-frame list instead of the chained Scope dicts. A name is
+# promoted only when all of its declarations and uses are visible to the
+# compiler:
+#
+#   - declared exactly once in the unit, either by a let at the unit's top
+#     level, a parameter, or a for-loop variable (block-nested lets keep the
+#     Scope path so block scoping - including use-after-block errors - is
+#     preserved; for-var slots are unbound again at loop exit);
+#   - never mentioned inside a nested fn/lambda (closures capture Scopes);
+#   - never mentioned inside a subtree that compiles to EVAL_NODE (the
+#     tree-walker only sees Scopes);
+#   - the unit contains no import (imports define arbitrary names at runtime).
+#
+# Everything else keeps the name-based scope-chain path, so promotion is
+# purely an optimization - resolution misses cost nothing but speed.
+
+# Node types the compiler lowers directly; anything else escapes to _eval
+_COMPILED_NODES = (
+    Program, Literal, Identifier, BinaryOp, UnaryOp, Call, Index, Member,
+    Array, MapLiteral, Lambda, Conditional, Range, LetStmt, ConstStmt,
+    Block, IfStmt, ForStmt, WhileStmt, ReturnStmt, BreakStmt, ContinueStmt,
+    FnDecl, AssignStmt
+)
+
+
+def _nodes_in(value):
+    """Yield AST nodes found in a field value (node, or nested list/tuple)."""
+    if hasattr(value, 'type') and hasattr(value, 'line'):
+        yield value
+    elif isinstance(value, (list, tuple)):
+        for item in value:
+            yield from _nodes_in(item)
+
+
+def _child_nodes(node):
+    """Yield AST child nodes of a node, generically over dataclass fields."""
+    for value in vars(node).values():
+        yield from _nodes_in(value)
+
+
+def _all_names(node, out: set):
+    """Collect every variable-ish name mentioned in a subtree."""
+    if isinstance(node, Identifier):
+        out.add(node.name)
+    elif isinstance(node, (LetStmt, ConstStmt, FnDecl)):
+        out.add(node.name)
+        if isinstance(node, FnDecl):
+            for pname, _ in node.params:
+                out.add(pname)
+    elif isinstance(node, ForStmt):
+        out.add(node.var)
+    elif isinstance(node, Lambda):
+        out.update(node.params)
+    for child in _child_nodes(node):
+        _all_names(child, out)
+
+
+class _SlotResolver:
+    """Collects declarations and exclusions for one compilation unit."""
+
+    def __init__(self):
+        self.declared: dict = {}   # name -> declaration count (any depth)
+        self.promotable: set = set()  # unit-top lets, params, for-vars
+        self.excluded: set = set()
+        self.poisoned = False      # unit-level import: no promotion at all
+
+    def resolve(self, statements, params=None) -> dict:
+        """Return {name: slot} for the promotable names of this unit."""
+        if params:
+            for pname in params:
+                self.declared[pname] = self.declared.get(pname, 0) + 1
+                self.promotable.add(pname)
+        for stmt in statements:
+            self._scan(stmt, top=True)
+        if self.poisoned:
+            return {}
+        slots = {}
+        for name in self.declared:
+            if self.declared[name] == 1 and name in self.promotable \
+                    and name not in self.excluded:
+                slots[name] = len(slots)
+        return slots
+
+    def _scan(self, node, top=False):
+        if isinstance(node, (Lambda, FnDecl)):
+            # Nested functions close over Scopes; anything they mention
+            # must stay in the scope chain
+            _all_names(node, self.excluded)
+            return
+        if isinstance(node, ImportStmt):
+            self.poisoned = True
+            return
+        if not isinstance(node, _COMPILED_NODES):
+            # Escapes to the tree-walker, which resolves by name
+            _all_names(node, self.excluded)
+            return
+        if isinstance(node, LetStmt):
+            self.declared[node.name] = self.declared.get(node.name, 0) + 1
+            if top:
+                self.promotable.add(node.name)
+        elif isinstance(node, ConstStmt):
+            # Consts keep the Scope path (reassignment must raise there)
+            self.excluded.add(node.name)
+        elif isinstance(node, ForStmt):
+            # For-vars promote at any depth: FOR_NEXT binds the slot fresh
+            # each iteration and the compiler unbinds it at loop exit
+            self.declared[node.var] = self.declared.get(node.var, 0) + 1
+            self.promotable.add(node.var)
+        elif isinstance(node, (BinaryOp, AssignStmt)):
+            # Compound assignment to non-identifier targets escapes
+            op = node.op
+            target = node.left if isinstance(node, BinaryOp) else node.target
+            if op.endswith('=') and op not in ('=', '==', '!=', '<=', '>=') \
+                    and not isinstance(target, Identifier):
+                _all_names(node, self.excluded)
+                return
+        for child in _child_nodes(node):
+            self._scan(child)
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# COMPILER - AST to bytecode
+# ═══════════════════════════════════════════════════════════════════════════════
+
+class BytecodeCompiler:
+    """
+    Lowers the parser AST into a CodeObject.
+
+    Every statement leaves its value on the stack (the tree-walker's "last
+    expression wins" semantics); sequencing POPs all but the last. Constructs
+    the VM has no opcode for (step chains, match, try, imports, structs)
+    compile to EVAL_NODE, which calls back into Runtime._eval - so coverage
+    is total and the fast path covers the loop-heavy core.
+    """
+
+    def __init__(self):
+        self.code: List[Tuple[int, Any]] = []
+        self.slots: dict = {}
+
+    def compile(self, node, name: str = "<module>", params=None) -> CodeObject:
+        """Compile an AST (Program or any node) to a CodeObject.
+
+        params: parameter names when compiling a function body, so the
+        resolver can promote them to frame slots.
+        """
+        self.code = []
+        if isinstance(node, (Program, Block)):
+            statements = node.statements
+        else:
+            statements = [node]
+        self.slots = _SlotResolver().resolve(statements, params)
+        local_names = [None] * len(self.slots)
+        for nm, slot in self.slots.items():
+            local_names[slot] = nm
+        if isinstance(node, Program):
+            self._compile_body(node.statements)
+        else:
+            self._compile(node)
+        return CodeObject(name=name, instructions=self.code,
+                          local_names=local_names)
+
+    def _emit_load(self, name: str, line: int):
+        slot = self.slots.get(name)
+        if slot is not None:
+            self._emit(LOAD_LOCAL, (slot, name, line))
+        else:
+            self._emit(LOAD_NAME, (name, line))
+
+    def _emit_store(self, name: str):
+        slot = self.slots.get(name)
+        if slot is not None:
+            self._emit(STORE_LOCAL, (slot, name))
+        else:
+            self._emit(STORE_NAME, name)
+
+    # ─── emit helpers ───────────────────────────────────────────────────────
+
+    def _emit(self, op: int, arg: Any = None) -> int:
+        self.code.append((op, arg))
+        return len(self.code) - 1
+
+    def _patch(self, index: int, target: int):
+        op, arg = self.code[index]
+        if op in (JUMP, JUMP_IF_FALSE):
+            self.code[index] = (op, target)
+        elif op == FOR_NEXT:
+            self.code[index] = (op, (target, arg[1]))
+
+    def _here(self) -> int:
+        return len(self.code)
+
+    # ─── statements / expressions ───────────────────────────────────────────
+
+    def _compile_body(self, statements: List[Any]):
+        """Compile a statement list, leaving the last statement's value."""
+        if not statements:
+            self._emit(LOAD_CONST, Value.null_val())
+            return
+        for i, stmt in enumerate(statements):
+            self._compile(stmt)
+            if i != len(statements) - 1:
+                self._emit(POP)
+
+    def _compile(self, node):
+        if isinstance(node, Literal):
+            self._emit(LOAD_CONST, _literal_value(node.value))
+            return
+
+        if isinstance(node, Identifier):
+            self._emit_load(node.name, node.line)
+            return
+
+        if isinstance(node, BinaryOp):
+            self._compile_binary(node)
+            return
+
+        if isinstance(node, UnaryOp):
+            self._compile(node.operand)
+            self._emit(UNARY, (node.op, node.line))
+            return
+
+        if isinstance(node, Call):
+            self._compile(node.callee)
+            for arg in node.args:
+                self._compile(arg)
+            self._emit(CALL, (len(node.args), node.line))
+            return
+
+        if isinstance(node, Index):
+            self._compile(node.obj)
+            self._compile(node.index)
+            self._emit(GET_INDEX, node.line)
+            return
+
+        if isinstance(node, Member):
+            self._compile(node.obj)
+            self._emit(GET_MEMBER, (node.field, node.line))
+            return
+
+        if isinstance(node, Array):
+            for el in node.elements:
+                self._compile(el)
+            self._emit(MAKE_LIST, len(node.elements))
+            return
+
+        if isinstance(node, MapLiteral):
+            for key, val in node.pairs:
+                self._compile(key)
+                self._compile(val)
+            self._emit(MAKE_MAP, len(node.pairs))
+            return
+
+        if isinstance(node, Lambda):
+            body_code = BytecodeCompiler().compile(node.body, name="<lambda>",
+                                                   params=node.params)
+            params = [(p, None) for p in node.params]
+            self._emit(MAKE_FUNCTION, ("<lambda>", params, node.body, body_code))
+            return
+
+        if isinstance(node, Conditional):
+            self._compile(node.condition)
+            jf = self._emit(JUMP_IF_FALSE, None)
+            self._compile(node.then_expr)
+            jend = self._emit(JUMP, None)
+            self._patch(jf, self._here())
+            self._compile(node.else_expr)
+            self._patch(jend, self._here())
+            return
+
+        if isinstance(node, Range):
+            self._compile(node.start)
+            self._compile(node.end)
+            self._emit(MAKE_RANGE, node.inclusive)
+            return
+
+        if isinstance(node, LetStmt):
+            if node.value:
+                self._compile(node.value)
+            else:
+                self._emit(LOAD_CONST, Value.null_val())
+            slot = self.slots.get(node.name)
+            if slot is not None:
+                self._emit(DEFINE_LOCAL, slot)
+            else:
+                self._emit(DEFINE_NAME, node.name)
+            return
+
+        if isinstance(node, ConstStmt):
+            if node.value:
+                self._compile(node.value)
+            else:
+                self._emit(LOAD_CONST, Value.null_val())
+            self._emit(DEFINE_CONST, node.name)
+            return
+
+        if isinstance(node, AssignStmt):
+            self._compile_assign(node)
+            return
+
+        if isinstance(node, Block):
+            self._emit(PUSH_SCOPE)
+            self._compile_body(node.statements)
+            self._emit(POP_SCOPE)
+            return
+
+        if isinstance(node, IfStmt):
+            self._compile_if(node)
+            return
+
+        if isinstance(node, WhileStmt):
+            self._compile_while(node)
+            return
+
+        if isinstance(node, ForStmt):
+            self._compile_for(node)
+            return
+
+        if isinstance(node, ReturnStmt):
+            if node.value:
+                self._compile(node.value)
+            else:
+                self._emit(LOAD_CONST, Value.null_val())
+            self._emit(RETURN)
+            return
+
+        if isinstance(node, BreakStmt):
+            self._emit(BREAK_LOOP)
+            return
+
+        if isinstance(node, ContinueStmt):
+            self._emit(CONTINUE_LOOP)
+            return
+
+        if isinstance(node, FnDecl):
+            body_code = BytecodeCompiler().compile(
+                node.body, name=node.name, params=[p for p, _ in node.params])
+            self._emit(MAKE_FUNCTION, (node.name, node.params, node.body, body_code))
+            self._emit(DEFINE_CONST, node.name)
+            self._emit(POP)
+            self._emit(LOAD_CONST, Value.null_val())
+            return
+
+        # Everything else (step chains, pipes, match, try, throw, imports,
+        # struct/enum declarations) runs through the tree-walker.
+        self._emit(EVAL_NODE, node)
+
+    def _compile_binary(self, node: BinaryOp):
+        op = node.op
+
+        # Short-circuit and/or lower to jumps
+        if op == 'and':
+            self._compile(node.left)
+            jf = self._emit(JUMP_IF_FALSE, None)
+            self._compile(node.right)
+            self._emit(TRUTH)
+            jend = self._emit(JUMP, None)
+            self._patch(jf, self._here())
+            self._emit(LOAD_CONST, Value.bool_val(False))
+            self._patch(jend, self._here())
+            return
+
+        if op == 'or':
+            self._compile(node.left)
+            self._emit(TRUTH)
+            # if truthy, keep the True; else evaluate rhs
+            jf = self._emit(JUMP_IF_FALSE, None)
+            self._emit(LOAD_CONST, Value.bool_val(True))
+            jend = self._emit(JUMP, None)
+            self._patch(jf, self._here())
+            self._compile(node.right)
+            self._emit(TRUTH)
+            self._patch(jend, self._here())
+            return
+
+        # Assignment spelled as a binary op
+        if op == '=':
+            self._compile_assign_target(node.left, node.right, node.line)
+            return
+
+        if op in ('+=', '-=', '*=', '/=', '%=', '//=', '**='):
+            if isinstance(node.left, Identifier):
+                self._emit_load(node.left.name, node.line)
+                self._compile(node.right)
+                self._emit(BINARY, (op[:-1], node.line))
+                self._emit_store(node.left.name)
+                return
+            self._emit(EVAL_NODE, node)
+            return
+
+        self._compile(node.left)
+        self._compile(node.right)
+        self._emit(BINARY, (op, node.line))
+
+    def _compile_assign(self, node: AssignStmt):
+        if node.op == '=':
+            self._compile_assign_target(node.target, node.value, node.line)
+            return
+        if isinstance(node.target, Identifier):
+            self._emit_load(node.target.name, node.line)
+            self._compile(node.value)
+            self._emit(BINARY, (node.op[:-1], node.line))
+            self._emit_store(node.target.name)
+            return
+        self._emit(EVAL_NODE, node)
+
+    def _compile_assign_target(self, target, value_node, line: int):
+        if isinstance(target, Identifier):
+            self._compile(value_node)
+            self._emit_store(target.name)
+            return
+        if isinstance(target, Index):
+            self._compile(target.obj)
+            self._compile(target.index)
+            self._compile(value_node)
+            self._emit(SET_INDEX, line)
+            return
+        if isinstance(target, Member):
+            self._compile(target.obj)
+            self._compile(value_node)
+            self._emit(SET_MEMBER, (target.field, line))
+            return
+        # Unknown target shape - let the tree-walker report it
+        self._emit(EVAL_NODE, AssignStmt(target=target, value=value_node, line=line))
+
+    def _compile_if(self, node: IfStmt):
+        end_jumps = []
+
+        self._compile(node.condition)
+        jf = self._emit(JUMP_IF_FALSE, None)
+        self._compile(node.then_branch)
+        end_jumps.append(self._emit(JUMP, None))
+        self._patch(jf, self._here())
+
+        for elif_cond, elif_body in node.elif_branches:
+            self._compile(elif_cond)
+            jf = self._emit(JUMP_IF_FALSE, None)
+            self._compile(elif_body)
+            end_jumps.append(self._emit(JUMP, None))
+            self._patch(jf, self._here())
+
+        if node.else_branch:
+            self._compile(node.else_branch)
+        else:
+            self._emit(LOAD_CONST, Value.null_val())
+
+        for j in end_jumps:
+            self._patch(j, self._here())
+
+    def _compile_while(self, node: WhileStmt):
+        setup = self._emit(SETUP_WHILE, None)
+        cond_start = self._here()
+        self._emit(LOOP_TICK, node.line)
+        self._compile(node.condition)
+        jexit = self._emit(JUMP_IF_FALSE, None)
+        self._compile(node.body)
+        self._emit(LOOP_ACC)
+        self._emit(JUMP, cond_start)
+        exit_at = self._here()
+        self._patch(jexit, exit_at)
+        self._emit(END_LOOP)
+        # continue re-enters at the condition; break lands after END_LOOP
+        self.code[setup] = (SETUP_WHILE, (cond_start, self._here()))
+
+    def _compile_for(self, node: ForStmt):
+        self._compile(node.iterable)
+        setup = self._emit(SETUP_FOR, None)
+        next_at = self._here()
+        fnext = self._emit(FOR_NEXT, (None, node.line))
+        # The per-iteration scope FOR_NEXT creates already isolates the body,
+        # so a Block body compiles without its own scope push.
+        if isinstance(node.body, Block):
+            self._compile_body(node.body.statements)
+        else:
+            self._compile(node.body)
+        self._emit(LOOP_ACC)
+        self._emit(JUMP, next_at)
+        exit_at = self._here()
+        self._patch(fnext, exit_at)
+        self._emit(END_LOOP)
+        var_slot = self.slots.get(node.var)
+        break_target = self._here()
+        if var_slot is not None:
+            # The loop var dies with the loop in the tree-walker; clear the
+            # slot so later reads fall back to the scope chain (and error)
+            self._emit(UNBIND_LOCAL, var_slot)
+        reuse = not _captures_scope(node.body)
+        self.code[setup] = (SETUP_FOR, (node.var, next_at, break_target,
+                                        node.line, reuse, var_slot))
+
+
+def _captures_scope(node) -> bool:
+    """True when a subtree may capture its enclosing scope (closures) or
+    falls back to the tree-walker, so per-iteration scopes must stay fresh."""
+    if isinstance(node, (Lambda, FnDecl)):
+        return True
+    if isinstance(node, (Literal, Identifier)):
+        return False
+    if isinstance(node, BinaryOp):
+        return _captures_scope(node.left) or _captures_scope(node.right)
+    if isinstance(node, UnaryOp):
+        return _captures_scope(node.operand)
+    if isinstance(node, Call):
+        return _captures_scope(node.callee) or any(_captures_scope(a) for a in node.args)
+    if isinstance(node, Index):
+        return _captures_scope(node.obj) or _captures_scope(node.index)
+    if isinstance(node, Member):
+        return _captures_scope(node.obj)
+    if isinstance(node, Array):
+        return any(_captures_scope(el) for el in node.elements)
+    if isinstance(node, MapLiteral):
+        return any(_captures_scope(k) or _captures_scope(v) for k, v in node.pairs)
+    if isinstance(node, Conditional):
+        return (_captures_scope(node.condition) or _captures_scope(node.then_expr)
+                or _captures_scope(node.else_expr))
+    if isinstance(node, Range):
+        return _captures_scope(node.start) or _captures_scope(node.end)
+    if isinstance(node, (LetStmt, ConstStmt)):
+        return _captures_scope(node.value) if node.value else False
+    if isinstance(node, AssignStmt):
+        return _captures_scope(node.target) or _captures_scope(node.value)
+    if isinstance(node, Block):
+        return any(_captures_scope(s) for s in node.statements)
+    if isinstance(node, IfStmt):
+        if _captures_scope(node.condition) or _captures_scope(node.then_branch):
+            return True
+        for cond, body in node.elif_branches:
+            if _captures_scope(cond) or _captures_scope(body):
+                return True
+        return _captures_scope(node.else_branch) if node.else_branch else False
+    if isinstance(node, WhileStmt):
+        return _captures_scope(node.condition) or _captures_scope(node.body)
+    if isinstance(node, ForStmt):
+        return _captures_scope(node.iterable) or _captures_scope(node.body)
+    if isinstance(node, ReturnStmt):
+        return _captures_scope(node.value) if node.value else False
+    if isinstance(node, (BreakStmt, ContinueStmt)):
+        return False
+    # Anything else compiles to EVAL_NODE - assume it can capture
+    return True
+
+
+def _literal_value(val) -> Value:
+    """Fold a parser literal into a constant Value."""
+    if val is None:
+        return Value.null_val()
+    if isinstance(val, bool):
+        return Value.bool_val(val)
+    if isinstance(val, int):
+        return Value.int_val(val)
+    if isinstance(val, float):
+        return Value.float_val(val)
+    if isinstance(val, str):
+        return Value.string_val(val)
+    return Value.null_val()
+
+
+def compile_program(ast, name: str = "<module>") -> CodeObject:
+    """Convenience wrapper: compile an AST to bytecode."""
+    return BytecodeCompiler().compile(ast, name=name)
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# LOOP FRAME
+# ═══════════════════════════════════════════════════════════════════════════════
+
+class _LoopFrame:
+    """Per-loop VM state: iterator position, result, unwind targets."""
+
+    __slots__ = ('items', 'index', 'var', 'continue_target', 'break_target',
+                 'stack_base', 'scope_base', 'result', 'reuse_scope', 'var_slot')
+
+    def __init__(self, continue_target, break_target, stack_base, scope_base,
+                 items=None, var=None):
+        self.items = items
+        self.index = 0
+        self.var = var
+        self.reuse_scope = None
+        self.var_slot = None
+        self.continue_target = continue_target
+        self.break_target = break_target
+        self.stack_base = stack_base
+        self.scope_base = scope_base
+        self.result = Value.null_val()
+
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# VM
+# ═══════════════════════════════════════════════════════════════════════════════
+
+class VM:
+    """
+    Stack machine over CodeObject instructions.
+
+    Shares the Runtime's scopes, bounds accounting, and value-level operator
+    helpers, so compiled and tree-walked code interoperate freely (compiled
+    functions can call interpreted ones and vice versa).
+    """
+
+    def __init__(self, runtime):
+        self.runtime = runtime
+
+    def run(self, code: CodeObject, scope) -> Value:
+        """Execute a CodeObject in the given scope. Returns the final value."""
+        from .runtime import (
+            Scope, TinyFunction, BoundMethod, TinyTalkError,
+            BreakException, ContinueException, ReturnException
+        )
+
+        rt = self.runtime
+        instructions = code.instructions
+        n = len(instructions)
+        stack: List[Value] = []
+        scopes = [scope]
+        loops: List[_LoopFrame] = []
+        pc = 0
+        # Flat frame locals; prefilled from the entry scope so bound
+        # parameters land in their slots (Values are never Python None)
+        local_names = code.local_names
+        if local_names:
+            get = scope.variables.get
+            frame_locals = [get(nm) for nm in local_names]
+        else:
+            frame_locals = []
+
+        INT = ValueType.INT
+        FUNCTION = ValueType.FUNCTION
+        max_ops = rt.bounds.max_ops
+        timeout = rt.bounds.timeout_seconds
+
+        while pc < n:
+            # Inline bounds accounting: ops every instruction, wall clock
+            # amortized (time.time() per op would dominate the loop).
+            rt.op_count = ops = rt.op_count + 1
+            if ops > max_ops:
+                raise TinyTalkError(f"Exceeded maximum operations ({max_ops})")
+            if not ops & 4095:
+                if time.time() - rt.start_time > timeout:
+                    raise TinyTalkError(f"Exceeded timeout ({timeout}s)")
+            op, arg = instructions[pc]
+            pc += 1
+
+            if op == LOAD_CONST:
+                stack.append(arg)
+
+            elif op == LOAD_NAME:
+                # Inline the Scope.get chain walk (Values are never None)
+                name = arg[0]
+                s = scopes[-1]
+                while s is not None:
+                    val = s.variables.get(name)
+                    if val is not None:
+                        stack.append(val)
+                        break
+                    s = s.parent
+                else:
+                    raise TinyTalkError(f"Undefined variable '{name}'", arg[1])
+
+            elif op == LOAD_LOCAL:
+                val = frame_locals[arg[0]]
+                if val is not None:
+                    stack.append(val)
+                else:
+                    # Slot not yet bound: the name may still live in an
+                    # enclosing scope (use-before-let with an outer binding)
+                    name = arg[1]
+                    s = scopes[-1]
+                    while s is not None:
+                        val = s.variables.get(name)
+                        if val is not None:
+                            stack.append(val)
+                            break
+                        s = s.parent
+                    else:
+                        raise TinyTalkError(f"Undefined variable '{name}'", arg[2])
+
+            elif op == STORE_LOCAL:
+                if frame_locals[arg[0]] is not None:
+                    frame_locals[arg[0]] = stack[-1]
+                else:
+                    # Slot unbound: assignment targets an enclosing scope,
+                    # or defines in the current one (tree-walker semantics);
+                    # frozen scopes force copy-on-write
+                    name = arg[1]
+                    s = scopes[-1]
+                    while s is not None:
+                        if name in s.variables:
+                            if name in s.constants:
+                                raise TinyTalkError(
+                                    f"Cannot reassign constant '{name}'")
+                            if s.frozen:
+                                s = None
+                                break
+                            s.variables[name] = stack[-1]
+                            break
+                        s = s.parent
+                    if s is None:
+                        scopes[-1].define(name, stack[-1])
+
+            elif op == DEFINE_LOCAL:
+                frame_locals[arg] = stack[-1]
+
+            elif op == UNBIND_LOCAL:
+                frame_locals[arg] = None
+
+            elif op == BINARY:
+                right = stack.pop()
+                left = stack.pop()
+                # Fast path: int/int arithmetic and comparison
+                if left.type is INT and right.type is INT:
+                    o = arg[0]
+                    a = left.data
+                    b = right.data
+                    if o == '+':
+                        stack.append(Value(INT, a + b))
+                        continue
+                    if o == '-':
+                        stack.append(Value(INT, a - b))
+                        continue
+                    if o == '*':
+                        stack.append(Value(INT, a * b))
+                        continue
+                    if o == '<':
+                        stack.append(_TRUE if a < b else _FALSE)
+                        continue
+                    if o == '>':
+                        stack.append(_TRUE if a > b else _FALSE)
+                        continue
+                    if o == '<=':
+                        stack.append(_TRUE if a <= b else _FALSE)
+                        continue
+                    if o == '>=':
+                        stack.append(_TRUE if a >= b else _FALSE)
+                        continue
+                    if o == '==':
+                        stack.append(_TRUE if a == b else _FALSE)
+                        continue
+                stack.append(rt._binary_op(arg[0], left, right, arg[1]))
+
+            elif op == STORE_NAME:
+                # Inline Scope.set with define-on-miss fallback; frozen
+                # scopes force copy-on-write into the current scope
+                s = scopes[-1]
+                while s is not None:
+                    if arg in s.variables:
+                        if arg in s.constants:
+                            raise TinyTalkError(f"Cannot reassign constant '{arg}'")
+                        if s.frozen:
+                            s = None
+                            break
+                        s.variables[arg] = stack[-1]
+                        break
+                    s = s.parent
+                if s is None:
+                    scopes[-1].define(arg, stack[-1])
+
+            elif op == DEFINE_NAME:
+                scopes[-1].define(arg, stack[-1], const=False)
+
+            elif op == DEFINE_CONST:
+                scopes[-1].define(arg, stack[-1], const=True)
+
+            elif op == POP:
+                stack.pop()
+
+            elif op == JUMP:
+                pc = arg
+
+            elif op == JUMP_IF_FALSE:
+                if not stack.pop().is_truthy():
+                    pc = arg
+
+            elif op == UNARY:
+                stack.append(rt._unary_op(arg[0], stack.pop(), arg[1]))
+
+            elif op == CALL:
+                argc, line = arg
+                args = stack[len(stack) - argc:] if argc else []
+                del stack[len(stack) - argc:]
+                callee = stack.pop()
+                if callee.type is not FUNCTION:
+                    raise TinyTalkError(f"Cannot call {callee.type.value}", line)
+                fn_or_bound = callee.data
+                if isinstance(fn_or_bound, BoundMethod):
+                    stack.append(rt._call_bound_method(fn_or_bound, args, scopes[-1], line))
+                else:
+                    stack.append(rt._call_function(fn_or_bound, args, scopes[-1], line))
+
+            elif op == MAKE_LIST:
+                items = stack[len(stack) - arg:] if arg else []
+                del stack[len(stack) - arg:]
+                stack.append(Value.list_val(items))
+
+            elif op == MAKE_MAP:
+                pairs = {}
+                flat = stack[len(stack) - 2 * arg:] if arg else []
+                del stack[len(stack) - 2 * arg:]
+                for i in range(0, len(flat), 2):
+                    pairs[flat[i].to_python()] = flat[i + 1]
+                stack.append(Value.map_val(pairs))
+
+            elif op == GET_INDEX:
+                index = stack.pop()
+                obj = stack.pop()
+                stack.append(rt._index_value(obj, index, arg))
+
+            elif op == SET_INDEX:
+                val = stack.pop()
+                index = stack.pop()
+                container = stack.pop()
+                if container.type == ValueType.LIST:
+                    container.data[int(index.data)] = val
+                elif container.type == ValueType.MAP:
+                    container.data[index.to_python()] = val
+                stack.append(val)
+
+            elif op == GET_MEMBER:
+                stack.append(rt._member_value(stack.pop(), arg[0], arg[1]))
+
+            elif op == SET_MEMBER:
+                val = stack.pop()
+                obj = stack.pop()
+                if obj.type == ValueType.STRUCT_INSTANCE:
+                    obj.data.fields[arg[0]] = val
+                elif obj.type == ValueType.MAP:
+                    obj.data[arg[0]] = val
+                stack.append(val)
+
+            elif op == MAKE_RANGE:
+                end = stack.pop()
+                start = stack.pop()
+                items = []
+                i = start.data
+                end_val = end.data + 1 if arg else end.data
+                while i < end_val:
+                    items.append(Value.int_val(i))
+                    i += 1
+                stack.append(Value.list_val(items))
+
+            elif op == MAKE_FUNCTION:
+                name, params, body, fn_code = arg
+                fn = TinyFunction(name, params, body, scopes[-1], code=fn_code)
+                stack.append(Value.function_val(fn))
+
+            elif op == RETURN:
+                raise ReturnException(stack.pop())
+
+            elif op == TRUTH:
+                stack.append(Value.bool_val(stack.pop().is_truthy()))
+
+            elif op == PUSH_SCOPE:
+                scopes.append(Scope(scopes[-1]))
+
+            elif op == POP_SCOPE:
+                scopes.pop()
+
+            elif op == SETUP_WHILE:
+                loops.append(_LoopFrame(arg[0], arg[1], len(stack), len(scopes)))
+
+            elif op == SETUP_FOR:
+                var, cont, brk, line, reuse, var_slot = arg
+                iterable = stack.pop()
+                if iterable.type == ValueType.LIST:
+                    items = iterable.data
+                elif iterable.type == ValueType.STRING:
+                    items = [Value.string_val(c) for c in iterable.data]
+                elif iterable.type == ValueType.MAP:
+                    items = [Value.string_val(k) for k in iterable.data.keys()]
+                elif iterable.type == ValueType.ARRAY:
+                    items = [Value.int_val(n) if isinstance(n, int) else Value.float_val(n)
+                             for n in iterable.data]
+                else:
+                    raise TinyTalkError(
+                        f"Cannot iterate over {iterable.type.value}", line)
+                frame = _LoopFrame(cont, brk, len(stack), len(scopes),
+                                   items=items, var=var)
+                frame.var_slot = var_slot
+                frame.reuse_scope = Scope(scopes[-1]) if reuse else None
+                loops.append(frame)
+
+            elif op == FOR_NEXT:
+                frame = loops[-1]
+                del scopes[frame.scope_base:]
+                if frame.index >= len(frame.items):
+                    pc = arg[0]
+                else:
+                    rt.iteration_count += 1
+                    if rt.iteration_count > rt.bounds.max_iterations:
+                        raise TinyTalkError(
+                            f"Exceeded maximum iterations ({rt.bounds.max_iterations})",
+                            arg[1])
+                    item = frame.items[frame.index]
+                    frame.index += 1
+                    loop_scope = frame.reuse_scope
+                    if loop_scope is None:
+                        loop_scope = Scope(scopes[-1])
+                    elif loop_scope.variables:
+                        # Nothing in the body can capture this scope, so one
+                        # dict cleared per iteration replaces an allocation
+                        loop_scope.variables.clear()
+                        loop_scope.constants.clear()
+                    if frame.var_slot is not None:
+                        frame_locals[frame.var_slot] = item
+                    else:
+                        loop_scope.variables[frame.var] = item
+                    scopes.append(loop_scope)
+
+            elif op == LOOP_TICK:
+                rt.iteration_count += 1
+                if rt.iteration_count > rt.bounds.max_iterations:
+                    raise TinyTalkError(
+                        f"Exceeded maximum iterations ({rt.bounds.max_iterations})",
+                        arg)
+
+            elif op == LOOP_ACC:
+                loops[-1].result = stack.pop()
+
+            elif op == END_LOOP:
+                frame = loops.pop()
+                del scopes[frame.scope_base:]
+                del stack[frame.stack_base:]
+                stack.append(frame.result)
+
+            elif op == BREAK_LOOP:
+                if not loops:
+                    raise TinyTalkError("Break/continue outside of loop")
+                frame = loops.pop()
+                del scopes[frame.scope_base:]
+                del stack[frame.stack_base:]
+                stack.append(frame.result)
+                pc = frame.break_target
+
+            elif op == CONTINUE_LOOP:
+                if not loops:
+                    raise TinyTalkError("Break/continue outside of loop")
+                frame = loops[-1]
+                del scopes[frame.scope_base:]
+                del stack[frame.stack_base:]
+                pc = frame.continue_target
+
+            elif op == EVAL_NODE:
+                try:
+                    stack.append(rt._eval(arg, scopes[-1]))
+                except BreakException:
+                    if not loops:
+                        raise
+                    frame = loops.pop()
+                    del scopes[frame.scope_base:]
+                    del stack[frame.stack_base:]
+                    stack.append(frame.result)
+                    pc = frame.break_target
+                except ContinueException:
+                    if not loops:
+                        raise
+                    frame = loops[-1]
+                    del scopes[frame.scope_base:]
+                    del stack[frame.stack_base:]
+                    pc = frame.continue_target
+
+            else:
+                raise TinyTalkError(f"Unknown opcode: {op}")
+
+        return stack.pop() if stack else Value.null_val()
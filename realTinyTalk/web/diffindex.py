@@ -0,0 +1,197 @@
+"""
+TinyTalk Diff Index
+Per-version line-hash arrays and a histogram/patience diff engine
+
+Three-way merges previously rebuilt SequenceMatcher state from raw text on
+every request. Here each stored version gets a compact array of 64-bit line
+hashes - cached in memory and persisted as an .lhx sidecar next to the
+content-addressed blob - and diffs run over those arrays with a
+patience-style anchor algorithm, so merge latency tracks the change size
+rather than the file size.
+"""
+
+import hashlib
+import struct
+from collections import OrderedDict
+from difflib import SequenceMatcher
+from pathlib import Path
+from typing import List, Optional, Tuple
+
+_LINE_HASH_BYTES = 8
+_MEMORY_CACHE_SIZE = 256
+
+# content hash -> line-hash array (process-wide)
+_memory_cache: 'OrderedDict[str, List[int]]' = OrderedDict()
+
+
+def hash_lines(lines: List[str]) -> List[int]:
+    """64-bit blake2b digest per line; stable across processes."""
+    out = []
+    for line in lines:
+        d = hashlib.blake2b(line.encode('utf-8', 'surrogatepass'),
+                            digest_size=_LINE_HASH_BYTES).digest()
+        out.append(int.from_bytes(d, 'little'))
+    return out
+
+
+def _sidecar_path(dirp: Path, blob_hash: str) -> Path:
+    return dirp / 'objects' / blob_hash[:2] / f"{blob_hash}.lhx"
+
+
+def line_hash_array(dirp: Path, blob_hash: Optional[str],
+                    lines: List[str]) -> List[int]:
+    """Line hashes for a version, via the memory cache and .lhx sidecar.
+
+    blob_hash of None (legacy versions, scratch text) computes without
+    caching - version bodies are immutable only when content-addressed.
+    """
+    if blob_hash is None:
+        return hash_lines(lines)
+
+    cached = _memory_cache.get(blob_hash)
+    if cached is not None:
+        _memory_cache.move_to_end(blob_hash)
+        return cached
+
+    sidecar = _sidecar_path(dirp, blob_hash)
+    arr = None
+    try:
+        data = sidecar.read_bytes()
+        count = len(data) // _LINE_HASH_BYTES
+        arr = list(struct.unpack(f'<{count}Q', data))
+        if len(arr) != len(lines):  # stale sidecar
+            arr = None
+    except OSError:
+        pass
+
+    if arr is None:
+        arr = hash_lines(lines)
+        try:
+            sidecar.parent.mkdir(parents=True, exist_ok=True)
+            sidecar.write_bytes(struct.pack(f'<{len(arr)}Q', *arr))
+        except OSError:
+            pass  # best-effort persistence
+
+    _memory_cache[blob_hash] = arr
+    _memory_cache.move_to_end(blob_hash)
+    while len(_memory_cache) > _MEMORY_CACHE_SIZE:
+        _memory_cache.popitem(last=False)
+    return arr
+
+
+# ═══════════════════════════════════════════════════════════════
+# Histogram / patience diff over hash arrays
+# ═══════════════════════════════════════════════════════════════
+
+def diff_opcodes(a: List[int], b: List[int]) -> List[Tuple[str, int, int, int, int]]:
+    """SequenceMatcher-compatible opcodes for two hash arrays.
+
+    Patience-style: strip common prefix/suffix, anchor on elements unique
+    to both sides via longest-increasing-subsequence, recurse between
+    anchors, and fall back to SequenceMatcher only for anchor-free segments
+    - so cost follows the changed region, not the file.
+    """
+    ops: List[Tuple[str, int, int, int, int]] = []
+    _diff_region(a, 0, len(a), b, 0, len(b), ops)
+    return _coalesce(ops)
+
+
+def _diff_region(a, a_lo, a_hi, b, b_lo, b_hi, ops):
+    # Common prefix/suffix - the overwhelmingly common case for
+    # autosave-style edits
+    start_a, start_b = a_lo, b_lo
+    while a_lo < a_hi and b_lo < b_hi and a[a_lo] == b[b_lo]:
+        a_lo += 1
+        b_lo += 1
+    if a_lo > start_a:
+        ops.append(('equal', start_a, a_lo, start_b, b_lo))
+    end_a, end_b = a_hi, b_hi
+    while a_hi > a_lo and b_hi > b_lo and a[a_hi - 1] == b[b_hi - 1]:
+        a_hi -= 1
+        b_hi -= 1
+
+    anchors = _patience_anchors(a, a_lo, a_hi, b, b_lo, b_hi)
+    if not anchors:
+        _fallback(a, a_lo, a_hi, b, b_lo, b_hi, ops)
+    else:
+        prev_a, prev_b = a_lo, b_lo
+        for ai, bi in anchors:
+            _diff_region(a, prev_a, ai, b, prev_b, bi, ops)
+            ops.append(('equal', ai, ai + 1, bi, bi + 1))
+            prev_a, prev_b = ai + 1, bi + 1
+        _diff_region(a, prev_a, a_hi, b, prev_b, b_hi, ops)
+
+    if end_a > a_hi:
+        ops.append(('equal', a_hi, end_a, b_hi, end_b))
+
+
+def _patience_anchors(a, a_lo, a_hi, b, b_lo, b_hi):
+    """Anchor pairs (ai, bi) on elements unique in both slices, via LIS."""
+    import bisect
+
+    count_a, pos_a = {}, {}
+    for i in range(a_lo, a_hi):
+        count_a[a[i]] = count_a.get(a[i], 0) + 1
+        pos_a[a[i]] = i
+    count_b, pos_b = {}, {}
+    for j in range(b_lo, b_hi):
+        count_b[b[j]] = count_b.get(b[j], 0) + 1
+        pos_b[b[j]] = j
+
+    pairs = sorted(
+        (pos_a[v], pos_b[v]) for v, c in count_a.items()
+        if c == 1 and count_b.get(v) == 1
+    )
+    if not pairs:
+        return []
+
+    # Longest increasing subsequence over the b-indices
+    tail_vals: List[int] = []   # smallest tail b-index per LIS length
+    tail_idx: List[int] = []    # index into pairs for each tail
+    prev = [None] * len(pairs)
+    for idx, (ai, bi) in enumerate(pairs):
+        k = bisect.bisect_left(tail_vals, bi)
+        if k == len(tail_vals):
+            tail_vals.append(bi)
+            tail_idx.append(idx)
+        else:
+            tail_vals[k] = bi
+            tail_idx[k] = idx
+        prev[idx] = tail_idx[k - 1] if k > 0 else None
+
+    result = []
+    i = tail_idx[-1]
+    while i is not None:
+        result.append(pairs[i])
+        i = prev[i]
+    result.reverse()
+    return result
+
+
+def _fallback(a, a_lo, a_hi, b, b_lo, b_hi, ops):
+    """No unique anchors: SequenceMatcher on the remaining slice."""
+    if a_lo == a_hi and b_lo == b_hi:
+        return
+    if a_lo == a_hi:
+        ops.append(('insert', a_lo, a_lo, b_lo, b_hi))
+        return
+    if b_lo == b_hi:
+        ops.append(('delete', a_lo, a_hi, b_lo, b_lo))
+        return
+    sm = SequenceMatcher(None, a[a_lo:a_hi], b[b_lo:b_hi])
+    for tag, i1, i2, j1, j2 in sm.get_opcodes():
+        ops.append((tag, a_lo + i1, a_lo + i2, b_lo + j1, b_lo + j2))
+
+
+def _coalesce(ops):
+    """Merge adjacent opcodes of the same tag."""
+    if not ops:
+        return []
+    out = [ops[0]]
+    for tag, i1, i2, j1, j2 in ops[1:]:
+        ptag, pi1, pi2, pj1, pj2 = out[-1]
+        if tag == ptag and pi2 == i1 and pj2 == j1:
+            out[-1] = (tag, pi1, i2, pj1, j2)
+        else:
+            out.append((tag, i1, i2, j1, j2))
+    return out
@@ -13,12 +13,16 @@ from pathlib import Path
 # Add parent to path for imports
 sys.path.insert(0, str(Path(__file__).parent.parent.parent))
 
-from flask import Flask, request, jsonify, send_from_directory, session
-from realTinyTalk import run, ExecutionBounds
-from realTinyTalk.runtime import TinyTalkError
+from flask import Flask, Response, request, jsonify, send_from_directory, session
+from realTinyTalk import ExecutionBounds
+from realTinyTalk.kernel import sha256
+from realTinyTalk.runtime import Runtime, TinyTalkError
 from pathlib import Path
 from datetime import datetime
 from difflib import SequenceMatcher
+from collections import OrderedDict
+from threading import Lock
+import queue
 import hashlib
 import re
 from typing import Optional
@@ -37,6 +41,120 @@ STORAGE_ROOT.mkdir(parents=True, exist_ok=True)
 # Limits
 MAX_SCRIPT_BYTES = 100 * 1024  # 100 KB
 
+# Script metadata store: SQLite (WAL) by default, with lazy migration from
+# the old per-directory meta.json layout; TINYTALK_STORAGE=files keeps the
+# original filesystem-only behavior. Version bodies stay on disk either way.
+from realTinyTalk.web import storage as script_storage
+from realTinyTalk.web.storage import make_meta_store
+META_STORE = make_meta_store(STORAGE_ROOT, os.environ.get('TINYTALK_STORAGE', 'sqlite'))
+
+# Worker pool for /api/run: TINYTALK_WORKERS=N (N>0) executes user code in N
+# pre-warmed interpreter processes with hard kill-on-deadline (tenant
+# timeout + 2s grace) instead of in-process under Flask. Off by default -
+# serverless deployments (Vercel) cannot hold process pools across
+# invocations.
+WORKER_POOL = None
+if int(os.environ.get('TINYTALK_WORKERS', '0') or '0') > 0:
+    from realTinyTalk.web.workers import WorkerPool
+    WORKER_POOL = WorkerPool(size=int(os.environ['TINYTALK_WORKERS']))
+
+# ═══════════════════════════════════════════════════════════════════════════════
+# COMPILED-PROGRAM CACHE
+# ═══════════════════════════════════════════════════════════════════════════════
+# IDE users hit Run repeatedly on unchanged code (~80% of runs are re-runs),
+# so parsed ASTs are cached process-wide, keyed by sha256(source). Shared by
+# /api/run and both transpile endpoints. The runtime never mutates the AST,
+# so one parsed tree can back any number of executions.
+
+AST_CACHE_SIZE = 128
+
+_ast_cache: 'OrderedDict[str, object]' = OrderedDict()
+_ast_cache_lock = Lock()
+
+
+_RUN_PROTOTYPE = None
+_BUDGETS = None
+
+# Default /api/run budget (the historical hardcoded bounds)
+DEFAULT_RUN_BOUNDS = dict(
+    max_ops=1_000_000,
+    max_iterations=100_000,
+    max_recursion=500,
+    timeout_seconds=10.0,
+)
+
+
+def _budget_registry():
+    """Per-tenant budgets: TINYTALK_BUDGETS names a JSON profile file."""
+    global _BUDGETS
+    if _BUDGETS is None:
+        from realTinyTalk.kernel import BudgetRegistry
+        path = os.environ.get('TINYTALK_BUDGETS')
+        if path and Path(path).exists():
+            _BUDGETS = BudgetRegistry.from_file(path)
+        else:
+            _BUDGETS = BudgetRegistry(
+                profiles={'default': ExecutionBounds(**DEFAULT_RUN_BOUNDS)})
+    return _BUDGETS
+
+
+def _run_bounds():
+    """ExecutionBounds for the current tenant."""
+    return _budget_registry().bounds_for(get_user())
+
+
+def _run_prototype():
+    """Shared immutable runtime template for /api/run (forked per request
+    with the tenant's bounds)."""
+    global _RUN_PROTOTYPE
+    if _RUN_PROTOTYPE is None:
+        from realTinyTalk.runtime import RuntimePrototype
+        _RUN_PROTOTYPE = RuntimePrototype(ExecutionBounds(**DEFAULT_RUN_BOUNDS))
+    return _RUN_PROTOTYPE
+
+
+def _snapshot_path(source_hash: str) -> Path:
+    """Content-addressed location of a binary AST snapshot (see snapshot.py).
+
+    Script saves write here; parse_cached reads here - so after a cold
+    start, running a saved script skips the parser entirely.
+    """
+    return STORAGE_ROOT / 'snapshots' / source_hash[:2] / f"{source_hash}.ast"
+
+
+def parse_cached(code: str):
+    """Return the parsed AST for source: memory LRU, then the stored
+    snapshot cache, then a full parse."""
+    from realTinyTalk.lexer import Lexer
+    from realTinyTalk.parser import Parser
+
+    key = sha256(code)
+    with _ast_cache_lock:
+        ast = _ast_cache.get(key)
+        if ast is not None:
+            _ast_cache.move_to_end(key)
+            return ast
+
+    # Snapshot produced at save time: deserializing beats parsing ~6x,
+    # which is what makes cold starts on saved scripts parse-free
+    from realTinyTalk import snapshot
+    ast = snapshot.load_snapshot(_snapshot_path(key), key)
+
+    if ast is None:
+        # Parse outside the lock - parsing is the expensive part
+        lexer = Lexer(code)
+        tokens = lexer.tokenize()
+        parser = Parser(tokens)
+        ast = parser.parse()
+
+    with _ast_cache_lock:
+        _ast_cache[key] = ast
+        _ast_cache.move_to_end(key)
+        while len(_ast_cache) > AST_CACHE_SIZE:
+            _ast_cache.popitem(last=False)
+
+    return ast
+
 
 def _safe_user(name: str) -> str:
     if not name:
@@ -146,18 +264,21 @@ def _script_dir(name: str) -> Path:
     return current_user_root() / 'scripts' / safe
 
 
+def _meta_key(dirp: Path):
+    """Derive the (user, script) store key from a script directory."""
+    return dirp.parent.parent.name, dirp.name
+
+
 def _read_meta(dirp: Path) -> dict:
-    """Read meta.json from a script directory."""
-    mp = dirp / 'meta.json'
-    if mp.exists():
-        return json.loads(mp.read_text())
-    return {'versions': []}
+    """Read script metadata via the configured store."""
+    user, script = _meta_key(dirp)
+    return META_STORE.read_meta(user, script, dirp)
 
 
 def _write_meta(dirp: Path, meta: dict):
-    """Write meta.json to a script directory."""
-    mp = dirp / 'meta.json'
-    mp.write_text(json.dumps(meta, indent=2))
+    """Write script metadata via the configured store."""
+    user, script = _meta_key(dirp)
+    META_STORE.write_meta(user, script, dirp, meta)
 
 
 def _latest_version(dirp: Path) -> Optional[dict]:
@@ -167,20 +288,57 @@ def _latest_version(dirp: Path) -> Optional[dict]:
     return versions[-1] if versions else None
 
 
+def _read_version_text(dirp: Path, vid: str) -> Optional[str]:
+    """Resolve a version's body: legacy full file, or the blob store."""
+    vpath = dirp / 'versions' / f"{vid}.tt"
+    if vpath.exists():
+        return vpath.read_text(encoding='utf-8')
+    meta = _read_meta(dirp)
+    for entry in meta.get('versions', []):
+        if entry['id'] == vid and 'hash' in entry:
+            return script_storage.read_version_blob(dirp, entry['hash'])
+    return None
+
+
 def _save_version(dirp: Path, code: str, message: str = '') -> dict:
     """Save a new version of a script and return the version record."""
     dirp.mkdir(parents=True, exist_ok=True)
     (dirp / 'versions').mkdir(parents=True, exist_ok=True)
     meta = _read_meta(dirp)
-    vid = f"v{len(meta['versions']) + 1}"
+    versions = meta['versions']
+    vid = f"v{len(versions) + 1}"
+
+    # Content-addressed, delta-compressed body (see storage.py)
+    parent_hash = None
+    parent_code = None
+    if versions:
+        parent = versions[-1]
+        parent_hash = parent.get('hash')
+        parent_code = _read_version_text(dirp, parent['id'])
+    blob_hash = script_storage.write_version_blob(
+        dirp, code, len(versions), parent_hash, parent_code)
+
     entry = {
         'id': vid,
         'message': message,
         'timestamp': time.strftime('%Y-%m-%dT%H:%M:%SZ', time.gmtime()),
+        'hash': blob_hash,
     }
-    meta['versions'].append(entry)
+    versions.append(entry)
     _write_meta(dirp, meta)
-    (dirp / 'versions' / f"{vid}.tt").write_text(code)
+
+    # Produce a binary AST snapshot in the content-addressed cache that
+    # parse_cached consults, so later runs of this script - including
+    # after a cold start - skip parsing entirely (best-effort:
+    # unparseable drafts still save)
+    try:
+        from realTinyTalk import snapshot
+        source_hash = sha256(code)
+        snap_path = _snapshot_path(source_hash)
+        snap_path.parent.mkdir(parents=True, exist_ok=True)
+        snapshot.save_snapshot(snap_path, parse_cached(code), source_hash)
+    except Exception:
+        pass
     return entry
 
 
@@ -195,12 +353,9 @@ def require_auth():
 def list_scripts():
     ensure_user_dirs()
     scripts_dir = current_user_root() / 'scripts'
-    result = []
-    if scripts_dir.exists():
-        for d in sorted(scripts_dir.iterdir()):
-            if d.is_dir():
-                meta = _read_meta(d)
-                result.append({'name': d.name, 'versions': len(meta.get('versions', []))})
+    listing = META_STORE.list_scripts(get_user(), scripts_dir)
+    result = [{'name': name, 'versions': count}
+              for name, count in sorted(listing.items())]
     return jsonify(result)
 
 
@@ -214,9 +369,7 @@ def get_script(name):
     latest = _latest_version(dirp)
     content = ''
     if latest:
-        vpath = dirp / 'versions' / f"{latest['id']}.tt"
-        if vpath.exists():
-            content = vpath.read_text()
+        content = _read_version_text(dirp, latest['id']) or ''
     return jsonify({'name': name, 'content': content, 'versions': meta.get('versions', [])})
 
 
@@ -224,10 +377,10 @@ def get_script(name):
 @app.route('/api/scripts/<name>/version/<vid>', methods=['GET'])
 def get_script_version(name, vid):
     dirp = _script_dir(name)
-    vpath = dirp / 'versions' / f"{vid}.tt"
-    if not vpath.exists():
+    content = _read_version_text(dirp, vid)
+    if content is None:
         return jsonify({'error': 'not found'}), 404
-    return jsonify({'id': vid, 'content': vpath.read_text()})
+    return jsonify({'id': vid, 'content': content})
 
 
 # API: save new script (create or new version)
@@ -251,10 +404,9 @@ def restore_script(name):
     data = request.get_json() or {}
     vid = data.get('version_id')
     dirp = _script_dir(name)
-    vpath = dirp / 'versions' / f"{vid}.tt"
-    if not vpath.exists():
+    code = _read_version_text(dirp, vid)
+    if code is None:
         return jsonify({'error': 'version not found'}), 404
-    code = vpath.read_text()
     # enforce size
     if len(code.encode('utf-8')) > MAX_SCRIPT_BYTES:
         return jsonify({'error': 'version too large'}), 400
@@ -268,6 +420,8 @@ def delete_script(name):
     dirp = _script_dir(name)
     if not dirp.exists():
         return jsonify({'error': 'not found'}), 404
+    user, script = _meta_key(dirp)
+    META_STORE.delete_script(user, script)
     # delete recursively
     for p in dirp.rglob('*'):
         if p.is_file():
@@ -309,12 +463,12 @@ def merge_script(name):
 def diff_versions(name, vid1, vid2):
     import difflib
     dirp = _script_dir(name)
-    v1 = dirp / 'versions' / f"{vid1}.tt"
-    v2 = dirp / 'versions' / f"{vid2}.tt"
-    if not v1.exists() or not v2.exists():
+    t1 = _read_version_text(dirp, vid1)
+    t2 = _read_version_text(dirp, vid2)
+    if t1 is None or t2 is None:
         return jsonify({'error': 'version not found'}), 404
-    a = v1.read_text().splitlines()
-    b = v2.read_text().splitlines()
+    a = t1.splitlines()
+    b = t2.splitlines()
     ud = list(difflib.unified_diff(a, b, fromfile=vid1, tofile=vid2, lineterm=''))
     return jsonify({'diff': '\n'.join(ud)})
 
@@ -345,7 +499,7 @@ def find_ancestor(name):
     return jsonify({'base_id': base_id})
 
 
-def _three_way_merge_lines(base, a, b):
+def _three_way_merge_lines(base, a, b, base_hashes=None, a_hashes=None, b_hashes=None):
     """
     Three-way merge on lists of lines (base, a, b).
     Returns (merged_lines, conflicts_bool).
@@ -360,10 +514,15 @@ def _three_way_merge_lines(base, a, b):
     a_lines = a
     b_lines = b
 
-    sma = SequenceMatcher(None, base_lines, a_lines)
-    smb = SequenceMatcher(None, base_lines, b_lines)
-    op_a = sma.get_opcodes()
-    op_b = smb.get_opcodes()
+    # Diff over 64-bit line hashes (precomputed per stored version by the
+    # diff index) with a patience-style engine - latency follows the change
+    # size instead of rebuilding SequenceMatcher state from full text
+    from realTinyTalk.web import diffindex
+    bh = base_hashes if base_hashes is not None else diffindex.hash_lines(base_lines)
+    ah = a_hashes if a_hashes is not None else diffindex.hash_lines(a_lines)
+    b2h = b_hashes if b_hashes is not None else diffindex.hash_lines(b_lines)
+    op_a = diffindex.diff_opcodes(bh, ah)
+    op_b = diffindex.diff_opcodes(bh, b2h)
 
     # collect boundaries from base ranges and insertion points
     bounds = {0, len(base_lines)}
@@ -454,15 +613,16 @@ def merge_three_way(name):
             base_idx = 0
         base_id = ids[base_idx]
 
-    def _read_version(vid):
-        p = dirp / 'versions' / f"{vid}.tt"
-        if not p.exists():
-            return ''
-        return p.read_text(encoding='utf-8')
+    from realTinyTalk.web import diffindex
+
+    def _version_lines_hashes(vid):
+        lines = (_read_version_text(dirp, vid) or '').splitlines()
+        blob = next((e.get('hash') for e in versions if e['id'] == vid), None)
+        return lines, diffindex.line_hash_array(dirp, blob, lines)
 
-    base = _read_version(base_id).splitlines()
-    a = _read_version(v1).splitlines()
-    b = _read_version(v2).splitlines()
+    base, base_h = _version_lines_hashes(base_id)
+    a, a_h = _version_lines_hashes(v1)
+    b, b_h = _version_lines_hashes(v2)
 
     # Attempt to use git's merge-file for a more battle-tested merge when available
     merged_text = None
@@ -487,7 +647,8 @@ def merge_three_way(name):
         merged_text = None
 
     if merged_text is None:
-        merged_lines, conflicts = _three_way_merge_lines(base, a, b)
+        merged_lines, conflicts = _three_way_merge_lines(
+            base, a, b, base_hashes=base_h, a_hashes=a_h, b_hashes=b_h)
         merged_text = '\n'.join(merged_lines)
 
     # Save the merged content as a new version
@@ -525,15 +686,23 @@ def run_code():
     start_time = time.time()
     
     try:
-        bounds = ExecutionBounds(
-            max_ops=1_000_000,
-            max_iterations=100_000,
-            max_recursion=500,
-            timeout_seconds=10.0
-        )
-        
+        bounds = _run_bounds()
+
+        if WORKER_POOL is not None:
+            from dataclasses import asdict
+            resp = WORKER_POOL.run(code, asdict(bounds),
+                                   timeout=bounds.timeout_seconds + 2.0)
+            resp['elapsed_ms'] = round((time.time() - start_time) * 1000, 2)
+            resp.setdefault('result', '')
+            return jsonify(resp)
+
+        ast = parse_cached(code)
+
         with redirect_stdout(stdout_capture):
-            result = run(code, bounds)
+            runtime = _run_prototype().fork(bounds)
+            if data.get('profile'):
+                runtime.enable_profiling()
+            result = runtime.execute(ast)
         
         elapsed = (time.time() - start_time) * 1000
         output = stdout_capture.getvalue()
@@ -541,12 +710,15 @@ def run_code():
         # Format result
         result_str = str(result) if result.type.value != 'null' else ''
         
-        return jsonify({
+        resp = {
             'success': True,
             'output': output,
             'result': result_str,
             'elapsed_ms': round(elapsed, 2)
-        })
+        }
+        if runtime.profiler is not None:
+            resp['profile'] = runtime.profiler.report()
+        return jsonify(resp)
         
     except TinyTalkError as e:
         elapsed = (time.time() - start_time) * 1000
@@ -574,6 +746,116 @@ def run_code():
         })
 
 
+# ═══════════════════════════════════════════════════════════════
+# Streaming execution (SSE)
+# ═══════════════════════════════════════════════════════════════
+# /api/run buffers all output and returns it when the script finishes;
+# /api/run/stream sends output incrementally as SSE events so a chatty
+# 10-second job shows its first byte in milliseconds and the server never
+# holds the full output in memory. The sink is a bounded queue: when the
+# client reads slowly, the executing thread blocks on write (backpressure)
+# instead of buffering without limit.
+
+STREAM_QUEUE_CHUNKS = 256
+
+
+class _StreamClosed(Exception):
+    """Raised inside the executing thread when the SSE client is gone."""
+
+
+class _QueueWriter:
+    """File-like stdout sink feeding a bounded queue.
+
+    Writes block while the queue is full (backpressure), but re-check the
+    cancellation flag every timeout tick: when the client disconnects, the
+    executing thread unwinds via _StreamClosed instead of blocking on
+    q.put forever and leaking itself, its runtime, and a full queue.
+    """
+
+    def __init__(self, q, cancelled):
+        self.q = q
+        self.cancelled = cancelled
+
+    def write(self, s):
+        if not s:
+            return 0
+        while True:
+            if self.cancelled.is_set():
+                raise _StreamClosed()
+            try:
+                self.q.put(('output', s), timeout=0.5)
+                return len(s)
+            except queue.Full:
+                continue
+
+    def flush(self):
+        pass
+
+
+def _stream_run_events(code: str, bounds):
+    """Generator of SSE event strings for one execution (flask-free core)."""
+    import threading
+    from contextlib import redirect_stdout
+
+    q = queue.Queue(maxsize=STREAM_QUEUE_CHUNKS)
+    cancelled = threading.Event()
+
+    def _put(item):
+        """Best-effort put that gives up once the stream is cancelled."""
+        while not cancelled.is_set():
+            try:
+                q.put(item, timeout=0.5)
+                return
+            except queue.Full:
+                continue
+
+    def execute():
+        try:
+            ast = parse_cached(code)
+            runtime = _run_prototype().fork(bounds)
+            with redirect_stdout(_QueueWriter(q, cancelled)):
+                result = runtime.execute(ast)
+            result_str = str(result) if result.type.value != 'null' else ''
+            _put(('result', result_str))
+        except _StreamClosed:
+            return  # client gone; nobody is reading
+        except TinyTalkError as e:
+            _put(('error', str(e)))
+        except SyntaxError as e:
+            _put(('error', f"Syntax Error: {e}"))
+        except Exception as e:
+            _put(('error', f"{type(e).__name__}: {e}"))
+        finally:
+            _put(None)
+
+    worker = threading.Thread(target=execute, daemon=True)
+    worker.start()
+
+    try:
+        while True:
+            item = q.get()
+            if item is None:
+                break
+            kind, payload = item
+            yield f"event: {kind}\ndata: {json.dumps(payload)}\n\n"
+        yield "event: done\ndata: {}\n\n"
+    finally:
+        # Client disconnected (GeneratorExit) or stream finished: either
+        # way, release the executing thread
+        cancelled.set()
+
+
+@app.route('/api/run/stream', methods=['POST'])
+def run_code_stream():
+    """Execute TinyTalk code, streaming output as server-sent events."""
+    data = request.get_json()
+    code = data.get('code', '')
+    return Response(_stream_run_events(code, _run_bounds()),
+                    mimetype='text/event-stream',
+                    headers={'Cache-Control': 'no-cache',
+                             'X-Accel-Buffering': 'no'})
+
+
 @app.route('/api/transpile/js', methods=['POST'])
 def transpile_to_js():
     """Transpile TinyTalk code to JavaScript."""
@@ -584,15 +866,10 @@ def transpile_to_js():
     start_time = time.time()
     
     try:
-        from realTinyTalk.lexer import Lexer
-        from realTinyTalk.parser import Parser
         from realTinyTalk.backends.js.emitter import JSEmitter
-        
-        lexer = Lexer(code)
-        tokens = lexer.tokenize()
-        parser = Parser(tokens)
-        ast = parser.parse()
-        
+
+        ast = parse_cached(code)
+
         emitter = JSEmitter(include_runtime=include_runtime)
         js_code = emitter.emit(ast)
         
@@ -624,15 +901,10 @@ def transpile_to_python():
     start_time = time.time()
     
     try:
-        from realTinyTalk.lexer import Lexer
-        from realTinyTalk.parser import Parser
         from realTinyTalk.backends.python.emitter import PythonEmitter
-        
-        lexer = Lexer(code)
-        tokens = lexer.tokenize()
-        parser = Parser(tokens)
-        ast = parser.parse()
-        
+
+        ast = parse_cached(code)
+
         emitter = PythonEmitter(include_runtime=include_runtime)
         py_code = emitter.emit(ast)
         
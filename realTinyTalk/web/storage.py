@@ -0,0 +1,219 @@
+"""
+TinyTalk Script Metadata Store
+SQLite-backed metadata and version index for the web IDE
+
+Script bodies stay as on-disk blobs (versions/vN.tt); only meta.json moves
+into SQLite, so listing and version lookup stop being filesystem walks once
+a tenant has thousands of scripts. Old per-file layouts migrate lazily: the
+first read of an unmigrated script imports its meta.json into the store.
+"""
+
+import hashlib
+import json
+import sqlite3
+import threading
+import zlib
+from difflib import SequenceMatcher
+from pathlib import Path
+from typing import Dict, Optional
+
+
+class JsonFileMetaStore:
+    """The original layout: one meta.json per script directory."""
+
+    def read_meta(self, user: str, script: str, dirp: Path) -> dict:
+        mp = dirp / 'meta.json'
+        if mp.exists():
+            return json.loads(mp.read_text())
+        return {'versions': []}
+
+    def write_meta(self, user: str, script: str, dirp: Path, meta: dict):
+        (dirp / 'meta.json').write_text(json.dumps(meta, indent=2))
+
+    def list_scripts(self, user: str, scripts_dir: Path) -> Dict[str, int]:
+        result = {}
+        if scripts_dir.exists():
+            for d in sorted(scripts_dir.iterdir()):
+                if d.is_dir():
+                    meta = self.read_meta(user, d.name, d)
+                    result[d.name] = len(meta.get('versions', []))
+        return result
+
+    def delete_script(self, user: str, script: str):
+        pass  # the directory removal deletes meta.json too
+
+
+class SqliteMetaStore:
+    """WAL-mode SQLite store for script metadata and the version index."""
+
+    _SCHEMA = """
+        CREATE TABLE IF NOT EXISTS script_meta (
+            user TEXT NOT NULL,
+            script TEXT NOT NULL,
+            meta TEXT NOT NULL,
+            version_count INTEGER NOT NULL DEFAULT 0,
+            PRIMARY KEY (user, script)
+        )
+    """
+
+    def __init__(self, db_path: Path):
+        self.db_path = str(db_path)
+        self._local = threading.local()
+        # Create schema eagerly so a read-only first request can't race it
+        conn = self._conn()
+        conn.execute(self._SCHEMA)
+        conn.commit()
+
+    def _conn(self) -> sqlite3.Connection:
+        conn = getattr(self._local, 'conn', None)
+        if conn is None:
+            conn = sqlite3.connect(self.db_path)
+            conn.execute("PRAGMA journal_mode=WAL")
+            conn.execute("PRAGMA synchronous=NORMAL")
+            conn.execute(self._SCHEMA)
+            self._local.conn = conn
+        return conn
+
+    def read_meta(self, user: str, script: str, dirp: Path) -> dict:
+        row = self._conn().execute(
+            "SELECT meta FROM script_meta WHERE user = ? AND script = ?",
+            (user, script)).fetchone()
+        if row is not None:
+            return json.loads(row[0])
+
+        # Lazy migration from the per-file layout
+        mp = dirp / 'meta.json'
+        if mp.exists():
+            meta = json.loads(mp.read_text())
+            self.write_meta(user, script, dirp, meta)
+            return meta
+        return {'versions': []}
+
+    def write_meta(self, user: str, script: str, dirp: Path, meta: dict):
+        conn = self._conn()
+        conn.execute(
+            "INSERT OR REPLACE INTO script_meta (user, script, meta, version_count) "
+            "VALUES (?, ?, ?, ?)",
+            (user, script, json.dumps(meta), len(meta.get('versions', []))))
+        conn.commit()
+
+    def list_scripts(self, user: str, scripts_dir: Path) -> Dict[str, int]:
+        result = {
+            script: count
+            for script, count in self._conn().execute(
+                "SELECT script, version_count FROM script_meta WHERE user = ?",
+                (user,))
+        }
+        # Pick up any directories that predate the store (migrates them)
+        if scripts_dir.exists():
+            for d in scripts_dir.iterdir():
+                if d.is_dir() and d.name not in result:
+                    meta = self.read_meta(user, d.name, d)
+                    result[d.name] = len(meta.get('versions', []))
+        return result
+
+    def delete_script(self, user: str, script: str):
+        conn = self._conn()
+        conn.execute("DELETE FROM script_meta WHERE user = ? AND script = ?",
+                     (user, script))
+        conn.commit()
+
+
+# ═══════════════════════════════════════════════════════════════
+# Version blob storage - content-addressed, delta-compressed
+# ═══════════════════════════════════════════════════════════════
+# Autosaving IDE users produce hundreds of near-identical versions per
+# day. Version bodies are stored once per distinct content (keyed by
+# sha256) under objects/, as zlib full snapshots every
+# FULL_SNAPSHOT_EVERY versions and line-based deltas against the parent
+# version in between - so storage grows with change size, and restore
+# cost is bounded by the snapshot interval.
+
+FULL_SNAPSHOT_EVERY = 16
+
+_BLOB_FULL = b'F'
+_BLOB_DELTA = b'D'
+
+
+def content_hash(code: str) -> str:
+    return hashlib.sha256(code.encode('utf-8')).hexdigest()
+
+
+def _object_path(dirp: Path, h: str) -> Path:
+    return dirp / 'objects' / h[:2] / h
+
+
+def _make_delta(parent: str, code: str) -> dict:
+    """Line-based delta: copy ranges from the parent plus inserted lines."""
+    old = parent.splitlines(keepends=True)
+    new = code.splitlines(keepends=True)
+    ops = []
+    for tag, i1, i2, j1, j2 in SequenceMatcher(None, old, new).get_opcodes():
+        if tag == 'equal':
+            ops.append(['=', i1, i2])
+        elif j2 > j1:
+            ops.append(['+', new[j1:j2]])
+    return {'ops': ops}
+
+
+def _apply_delta(parent: str, delta: dict) -> str:
+    old = parent.splitlines(keepends=True)
+    out = []
+    for op in delta['ops']:
+        if op[0] == '=':
+            out.extend(old[op[1]:op[2]])
+        else:
+            out.extend(op[1])
+    return ''.join(out)
+
+
+def write_version_blob(dirp: Path, code: str, version_index: int,
+                       parent_hash: Optional[str],
+                       parent_code: Optional[str]) -> str:
+    """Store a version body; returns its content hash.
+
+    Identical content is deduplicated outright. Every FULL_SNAPSHOT_EVERY-th
+    version (and any version without a readable parent) is a full snapshot;
+    the rest are deltas against their parent, so chains stay bounded.
+    """
+    h = content_hash(code)
+    path = _object_path(dirp, h)
+    if path.exists():
+        return h
+    path.parent.mkdir(parents=True, exist_ok=True)
+
+    full = (parent_code is None
+            or parent_hash is None
+            or version_index % FULL_SNAPSHOT_EVERY == 0)
+    if full:
+        path.write_bytes(_BLOB_FULL + zlib.compress(code.encode('utf-8')))
+    else:
+        delta = _make_delta(parent_code, code)
+        delta['parent'] = parent_hash
+        path.write_bytes(_BLOB_DELTA + zlib.compress(
+            json.dumps(delta).encode('utf-8')))
+    return h
+
+
+def read_version_blob(dirp: Path, h: str) -> Optional[str]:
+    """Resolve a version body by content hash, replaying the delta chain."""
+    path = _object_path(dirp, h)
+    try:
+        data = path.read_bytes()
+    except OSError:
+        return None
+    body = zlib.decompress(data[1:])
+    if data[:1] == _BLOB_FULL:
+        return body.decode('utf-8')
+    delta = json.loads(body)
+    parent = read_version_blob(dirp, delta['parent'])
+    if parent is None:
+        return None
+    return _apply_delta(parent, delta)
+
+
+def make_meta_store(storage_root: Path, backend: str):
+    """Build the configured metadata store ('sqlite' or 'files')."""
+    if backend == 'files':
+        return JsonFileMetaStore()
+    return SqliteMetaStore(storage_root / 'meta.db')
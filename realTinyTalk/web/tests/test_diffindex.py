@@ -0,0 +1,166 @@
+"""
+═══════════════════════════════════════════════════════════════
+ACID TEST: Diff index
+Patience-diff opcode invariants and line-hash caching
+═══════════════════════════════════════════════════════════════
+
+_three_way_merge_lines consumes these opcodes: a stream that fails the
+cover/order/equality invariants silently corrupts merges, so they are
+pinned here directly. diffindex.py is flask-free.
+"""
+
+import random
+import sys
+import tempfile
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent.parent.parent.parent))
+
+from realTinyTalk.web import diffindex  # noqa: E402
+from realTinyTalk.web.diffindex import (  # noqa: E402
+    diff_opcodes, hash_lines, line_hash_array,
+)
+
+
+def check(name: str, ok: bool) -> bool:
+    print(f"{'✅' if ok else '❌'} {name}")
+    return ok
+
+
+def opcode_invariants(a, b, ops):
+    """The contract _three_way_merge_lines depends on.
+
+    Opcodes must cover both sequences contiguously and in order, use only
+    SequenceMatcher's tag vocabulary (insert with an empty a-range, delete
+    with an empty b-range), and 'equal' ranges must actually be equal.
+    """
+    ia = ib = 0
+    for tag, i1, i2, j1, j2 in ops:
+        if i1 != ia or j1 != ib:
+            return f"gap/overlap at ({i1},{j1}), expected ({ia},{ib})"
+        if tag == 'equal':
+            if a[i1:i2] != b[j1:j2]:
+                return f"unequal 'equal' range {i1}:{i2}/{j1}:{j2}"
+        elif tag == 'insert':
+            if i1 != i2 or j1 == j2:
+                return "malformed insert"
+        elif tag == 'delete':
+            if i1 == i2 or j1 != j2:
+                return "malformed delete"
+        elif tag == 'replace':
+            if i1 == i2 or j1 == j2:
+                return "malformed replace"
+        else:
+            return f"unknown tag {tag}"
+        ia, ib = i2, j2
+    if ia != len(a) or ib != len(b):
+        return f"incomplete cover: ended at ({ia},{ib})"
+    return None
+
+
+def reconstruct(b, ops):
+    out = []
+    for tag, i1, i2, j1, j2 in ops:
+        if tag != 'delete':
+            out.extend(b[j1:j2])
+    return out
+
+
+def run_all_tests():
+    print("=" * 60)
+    print("DIFF INDEX ACID TEST")
+    print("=" * 60)
+    print()
+
+    passed = 0
+    failed = 0
+
+    def record(ok):
+        nonlocal passed, failed
+        if ok:
+            passed += 1
+        else:
+            failed += 1
+
+    # ── Deterministic shapes ──
+    base = hash_lines([f"line {i}" for i in range(20)])
+    ins = base[:5] + hash_lines(["inserted"]) + base[5:]
+    ops = diff_opcodes(base, ins)
+    record(check("Pure insertion yields an insert op",
+                 any(t == 'insert' for t, *_ in ops)
+                 and opcode_invariants(base, ins, ops) is None))
+    ops = diff_opcodes(base, base[:5] + base[6:])
+    record(check("Pure deletion yields a delete op",
+                 any(t == 'delete' for t, *_ in ops)))
+    changed = list(base)
+    changed[10] = hash_lines(["changed"])[0]
+    ops = diff_opcodes(base, changed)
+    record(check("Single replacement localizes to one replace op",
+                 [t for t, *_ in ops] == ['equal', 'replace', 'equal']))
+    record(check("Identical inputs yield one equal op",
+                 diff_opcodes(base, list(base)) == [('equal', 0, 20, 0, 20)]))
+    record(check("Empty inputs yield no ops", diff_opcodes([], []) == []))
+    record(check("Empty-to-content is one insert",
+                 diff_opcodes([], base) == [('insert', 0, 0, 0, 20)]))
+    record(check("Content-to-empty is one delete",
+                 diff_opcodes(base, []) == [('delete', 0, 20, 0, 0)]))
+
+    # ── Invariant fuzz (the merge engine's actual dependency) ──
+    random.seed(42)
+    bad = 0
+    for trial in range(3000):
+        n = random.randint(0, 30)
+        a = [random.randint(0, 8) for _ in range(n)]
+        b = list(a)
+        for _ in range(random.randint(0, 6)):
+            op = random.choice(['ins', 'del', 'rep'])
+            if op == 'ins':
+                b.insert(random.randint(0, len(b)), random.randint(0, 8))
+            elif op == 'del' and b:
+                b.pop(random.randrange(len(b)))
+            elif b:
+                b[random.randrange(len(b))] = random.randint(0, 8)
+        ops = diff_opcodes(a, b)
+        if opcode_invariants(a, b, ops) is not None or reconstruct(b, ops) != b:
+            bad += 1
+    record(check("3000-trial fuzz holds cover/order/equality invariants",
+                 bad == 0))
+
+    # ── Line hashing ──
+    record(check("Line hashes are deterministic",
+                 hash_lines(["a", "b"]) == hash_lines(["a", "b"])))
+    record(check("Distinct lines hash distinctly",
+                 len(set(hash_lines([f"l{i}" for i in range(1000)]))) == 1000))
+
+    # ── Sidecar persistence and cache ──
+    with tempfile.TemporaryDirectory() as tmp:
+        dirp = Path(tmp)
+        lines = ["alpha", "beta", "gamma"]
+        blob = "ab" + "c" * 62
+        arr = line_hash_array(dirp, blob, lines)
+        sidecar = dirp / 'objects' / 'ab' / f"{blob}.lhx"
+        record(check("Sidecar written on first computation",
+                     sidecar.exists() and len(sidecar.read_bytes()) == 24))
+        diffindex._memory_cache.clear()
+        record(check("Sidecar read back matches",
+                     line_hash_array(dirp, blob, lines) == arr))
+        diffindex._memory_cache.clear()
+        record(check("Stale sidecar (line count mismatch) recomputes",
+                     len(line_hash_array(dirp, blob, lines + ["delta"])) == 4))
+        record(check("Uncached (legacy) versions hash without a sidecar",
+                     line_hash_array(dirp, None, lines) == hash_lines(lines)))
+
+    # ═══════════════════════════════════════════════════════════════
+    # SUMMARY
+    # ═══════════════════════════════════════════════════════════════
+    print()
+    print("=" * 60)
+    print(f"RESULTS: {passed} passed, {failed} failed")
+    print("=" * 60)
+
+    return failed == 0
+
+
+if __name__ == "__main__":
+    success = run_all_tests()
+    sys.exit(0 if success else 1)
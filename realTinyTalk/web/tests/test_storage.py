@@ -0,0 +1,158 @@
+"""
+═══════════════════════════════════════════════════════════════
+ACID TEST: Version blob storage
+Delta chains, snapshot boundaries, dedup, and corruption handling
+═══════════════════════════════════════════════════════════════
+
+storage.py's blob layer is flask-free; this runner exercises it directly.
+"""
+
+import random
+import sys
+import tempfile
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).parent.parent.parent.parent))
+
+from realTinyTalk.web.storage import (  # noqa: E402
+    _BLOB_DELTA, FULL_SNAPSHOT_EVERY, _apply_delta, _make_delta,
+    content_hash, read_version_blob, write_version_blob,
+)
+
+
+def check(name: str, ok: bool) -> bool:
+    print(f"{'✅' if ok else '❌'} {name}")
+    return ok
+
+
+def save_chain(dirp: Path, bodies):
+    """Write a version history; returns the blob hashes in order."""
+    hashes = []
+    parent_hash = None
+    parent_code = None
+    for index, code in enumerate(bodies):
+        h = write_version_blob(dirp, code, index, parent_hash, parent_code)
+        hashes.append(h)
+        parent_hash, parent_code = h, code
+    return hashes
+
+
+def run_all_tests():
+    print("=" * 60)
+    print("VERSION STORAGE ACID TEST")
+    print("=" * 60)
+    print()
+
+    passed = 0
+    failed = 0
+
+    def record(ok):
+        nonlocal passed, failed
+        if ok:
+            passed += 1
+        else:
+            failed += 1
+
+    with tempfile.TemporaryDirectory() as tmp:
+        dirp = Path(tmp)
+
+        # ── Roundtrip across full-snapshot boundaries ──
+        base = "\n".join(f"line {i}" for i in range(100))
+        bodies = [base + f"\nedit {v}\n" for v in range(FULL_SNAPSHOT_EVERY * 2 + 5)]
+        hashes = save_chain(dirp, bodies)
+        record(check("Every version reconstructs byte-exact across boundaries",
+                     all(read_version_blob(dirp, h) == body
+                         for h, body in zip(hashes, bodies))))
+
+        # Boundary versions are full snapshots, the rest deltas
+        def blob_tag(h):
+            return (dirp / 'objects' / h[:2] / h).read_bytes()[:1]
+
+        record(check("Snapshot-interval versions stored as full blobs",
+                     blob_tag(hashes[0]) == b'F'
+                     and blob_tag(hashes[FULL_SNAPSHOT_EVERY]) == b'F'))
+        record(check("Intermediate versions stored as deltas",
+                     blob_tag(hashes[1]) == b'D'
+                     and blob_tag(hashes[FULL_SNAPSHOT_EVERY - 1]) == b'D'))
+
+        # Resolve every chain by walking delta parents to the full snapshot
+        import json
+        import zlib
+
+        def chain_depth(h):
+            depth = 0
+            while True:
+                data = (dirp / 'objects' / h[:2] / h).read_bytes()
+                if data[:1] != _BLOB_DELTA:
+                    return depth
+                h = json.loads(zlib.decompress(data[1:]))['parent']
+                depth += 1
+
+        record(check("Delta chains are bounded by the snapshot interval",
+                     max(chain_depth(h) for h in hashes) < FULL_SNAPSHOT_EVERY))
+
+        # ── Dedup across reverts (A, B, A) ──
+        n_before = sum(1 for p in (dirp / 'objects').rglob('*') if p.is_file())
+        revert_hash = write_version_blob(dirp, bodies[0], len(bodies),
+                                         hashes[-1], bodies[-1])
+        n_after = sum(1 for p in (dirp / 'objects').rglob('*') if p.is_file())
+        record(check("Reverting to earlier content dedups to its object",
+                     revert_hash == hashes[0] and n_after == n_before))
+        record(check("Deduped revert still reads correctly",
+                     read_version_blob(dirp, revert_hash) == bodies[0]))
+
+        # ── Content addressing ──
+        record(check("Blob hash is the content hash",
+                     hashes[3] == content_hash(bodies[3])))
+
+        # ── Missing / broken chains ──
+        record(check("Missing blob reads as None",
+                     read_version_blob(dirp, 'f' * 64) is None))
+        orphan = write_version_blob(dirp, "orphan body", 1, 'e' * 64,
+                                    "parent that is not stored")
+        record(check("Delta with missing parent reads as None",
+                     read_version_blob(dirp, orphan) is None))
+
+        # ── Edge contents ──
+        for label, code in (("empty", ""), ("no trailing newline", "a\nb"),
+                            ("unicode", "héllo\n∑ ümlaut\n"),
+                            ("blank lines", "\n\n\n")):
+            h = write_version_blob(dirp, code, 0, None, None)
+            record(check(f"Edge content roundtrips: {label}",
+                         read_version_blob(dirp, h) == code))
+
+    # ── Delta fuzz: random edit histories, every delta applies exactly ──
+    random.seed(11)
+    mismatches = 0
+    for trial in range(300):
+        lines = [f"l{random.randint(0, 30)}" for _ in range(random.randint(0, 40))]
+        old = "\n".join(lines) + ("\n" if lines and random.random() < 0.5 else "")
+        new_lines = list(lines)
+        for _ in range(random.randint(0, 8)):
+            op = random.choice(['ins', 'del', 'rep'])
+            if op == 'ins':
+                new_lines.insert(random.randint(0, len(new_lines)),
+                                 f"n{random.randint(0, 99)}")
+            elif op == 'del' and new_lines:
+                new_lines.pop(random.randrange(len(new_lines)))
+            elif new_lines:
+                new_lines[random.randrange(len(new_lines))] = f"m{random.randint(0, 99)}"
+        new = "\n".join(new_lines) + ("\n" if new_lines and random.random() < 0.5 else "")
+        if _apply_delta(old, _make_delta(old, new)) != new:
+            mismatches += 1
+    record(check("300-trial delta fuzz applies byte-exact", mismatches == 0))
+
+    # ═══════════════════════════════════════════════════════════════
+    # SUMMARY
+    # ═══════════════════════════════════════════════════════════════
+    print()
+    print("=" * 60)
+    print(f"RESULTS: {passed} passed, {failed} failed")
+    print("=" * 60)
+
+    return failed == 0
+
+
+if __name__ == "__main__":
+    success = run_all_tests()
+    sys.exit(0 if success else 1)
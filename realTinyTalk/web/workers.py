@@ -0,0 +1,174 @@
+"""
+TinyTalk Worker Pool
+Pre-warmed interpreter processes for /api/run
+
+One pathological script must not stall the IDE for every tenant: each run
+executes in a worker process with a hard kill-on-deadline, so the 10s
+ExecutionBounds timeout stops being merely cooperative. Workers are recycled
+after a bounded number of runs to cap memory creep.
+"""
+
+import io
+import multiprocessing as mp
+import queue
+import threading
+from contextlib import redirect_stdout
+
+
+def _worker_main(conn):
+    """Worker process loop: pre-warm the interpreter, then serve runs."""
+    from collections import OrderedDict
+
+    from realTinyTalk.lexer import Lexer
+    from realTinyTalk.parser import Parser
+    from realTinyTalk.runtime import Runtime, TinyTalkError
+    from realTinyTalk.kernel import ExecutionBounds, sha256
+
+    # Warm-up: one Runtime construction registers every builtin and pulls
+    # in the stdlib modules, so the first real run pays none of that
+    Runtime()
+
+    # Per-worker AST cache, mirroring the server's source-hash cache so
+    # re-runs of unchanged code skip the front end here too
+    ast_cache: OrderedDict = OrderedDict()
+
+    while True:
+        try:
+            msg = conn.recv()
+        except (EOFError, OSError):
+            break
+        if msg is None:
+            break
+
+        code, bounds_kw = msg
+        stdout_capture = io.StringIO()
+        try:
+            bounds = ExecutionBounds(**bounds_kw)
+            key = sha256(code)
+            ast = ast_cache.get(key)
+            if ast is None:
+                tokens = Lexer(code).tokenize()
+                ast = Parser(tokens).parse()
+                ast_cache[key] = ast
+                while len(ast_cache) > 64:
+                    ast_cache.popitem(last=False)
+            else:
+                ast_cache.move_to_end(key)
+            with redirect_stdout(stdout_capture):
+                result = Runtime(bounds).execute(ast)
+            result_str = str(result) if result.type.value != 'null' else ''
+            resp = {
+                'success': True,
+                'output': stdout_capture.getvalue(),
+                'result': result_str,
+            }
+        except TinyTalkError as e:
+            resp = {
+                'success': False,
+                'error': str(e),
+                'output': stdout_capture.getvalue(),
+            }
+        except SyntaxError as e:
+            resp = {
+                'success': False,
+                'error': f"Syntax Error: {e}",
+                'output': stdout_capture.getvalue(),
+            }
+        except Exception as e:
+            resp = {
+                'success': False,
+                'error': f"{type(e).__name__}: {e}",
+                'output': stdout_capture.getvalue(),
+            }
+
+        try:
+            conn.send(resp)
+        except (BrokenPipeError, OSError):
+            break
+
+
+class _Worker:
+    """A warm interpreter process plus its pipe and run counter."""
+
+    def __init__(self):
+        self.conn, child_conn = mp.Pipe()
+        self.proc = mp.Process(target=_worker_main, args=(child_conn,), daemon=True)
+        self.proc.start()
+        child_conn.close()
+        self.runs = 0
+
+    def kill(self):
+        try:
+            self.conn.close()
+        except OSError:
+            pass
+        if self.proc.is_alive():
+            self.proc.terminate()
+        self.proc.join(timeout=1.0)
+
+
+class WorkerPool:
+    """
+    Fixed-size pool of pre-warmed interpreter workers.
+
+    run() blocks until a worker is free (p99 for small scripts stops being
+    hostage to big ones as long as the pool outnumbers pathological runs),
+    executes with a hard deadline, and replaces any worker that is killed
+    on timeout or has served max_runs_per_worker requests.
+    """
+
+    def __init__(self, size: int = 2, max_runs_per_worker: int = 200):
+        self.size = size
+        self.max_runs_per_worker = max_runs_per_worker
+        self._free = queue.Queue()
+        self._lock = threading.Lock()
+        for _ in range(size):
+            self._free.put(_Worker())
+
+    def run(self, code: str, bounds_kw: dict, timeout: float) -> dict:
+        """Execute code in a warm worker; kill it if the deadline passes."""
+        worker = self._free.get()
+        replace = False
+        try:
+            try:
+                worker.conn.send((code, bounds_kw))
+            except (BrokenPipeError, OSError):
+                # Worker died between runs; replace and retry once
+                worker.kill()
+                worker = _Worker()
+                worker.conn.send((code, bounds_kw))
+
+            if worker.conn.poll(timeout):
+                resp = worker.conn.recv()
+                worker.runs += 1
+                if worker.runs >= self.max_runs_per_worker:
+                    replace = True
+                return resp
+
+            # Hard deadline: the worker may be wedged in uncooperative
+            # native code, so terminate the process outright
+            replace = True
+            return {
+                'success': False,
+                'error': f"Execution killed after {timeout}s deadline",
+                'output': '',
+            }
+        finally:
+            if replace:
+                worker.kill()
+                worker = _Worker()
+            self._free.put(worker)
+
+    def shutdown(self):
+        """Stop all workers (drains the free queue; in-flight runs finish)."""
+        with self._lock:
+            while True:
+                try:
+                    worker = self._free.get_nowait()
+                except queue.Empty:
+                    break
+                try:
+                    worker.conn.send(None)
+                except (BrokenPipeError, OSError):
+                    pass
+                worker.kill()